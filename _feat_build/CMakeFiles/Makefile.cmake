@@ -0,0 +1,281 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "src/com/CMakeLists.txt"
+  "src/modules/CMakeLists.txt"
+  "/root/repo/buildsupport/check_compiler_features.cmake"
+  "/root/repo/buildsupport/forte.cmake"
+  "/root/repo/buildsupport/generate_modules_cmake_file.cmake"
+  "/root/repo/buildsupport/opcua.cmake"
+  "/root/repo/forte_config.h.in"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/arch/CMakeLists.txt"
+  "/root/repo/src/arch/be_m1/CMakeLists.txt"
+  "/root/repo/src/arch/ecos/CMakeLists.txt"
+  "/root/repo/src/arch/ecos/nios2/CMakeLists.txt"
+  "/root/repo/src/arch/ecos/phycoreat91/CMakeLists.txt"
+  "/root/repo/src/arch/freeRTOS/CMakeLists.txt"
+  "/root/repo/src/arch/macos/CMakeLists.txt"
+  "/root/repo/src/arch/netos/CMakeLists.txt"
+  "/root/repo/src/arch/netos/netos74/CMakeLists.txt"
+  "/root/repo/src/arch/pikeos_posix/CMakeLists.txt"
+  "/root/repo/src/arch/plcnext/CMakeLists.txt"
+  "/root/repo/src/arch/posix/CMakeLists.txt"
+  "/root/repo/src/arch/rcX/CMakeLists.txt"
+  "/root/repo/src/arch/utils/CMakeLists.txt"
+  "/root/repo/src/arch/vxworks/CMakeLists.txt"
+  "/root/repo/src/arch/win32/CMakeLists.txt"
+  "/root/repo/src/com/CMakeLists.txt"
+  "/root/repo/src/com/HTTP/CMakeLists.txt"
+  "/root/repo/src/com/modbus/CMakeLists.txt"
+  "/root/repo/src/com/mqtt_paho/CMakeLists.txt"
+  "/root/repo/src/com/opc/CMakeLists.txt"
+  "/root/repo/src/com/opc_ua/CMakeLists.txt"
+  "/root/repo/src/com/powerlink/CMakeLists.txt"
+  "/root/repo/src/com/ros/CMakeLists.txt"
+  "/root/repo/src/com/tsn/CMakeLists.txt"
+  "/root/repo/src/com/xquery/CMakeLists.txt"
+  "/root/repo/src/core/CMakeLists.txt"
+  "/root/repo/src/core/cominfra/CMakeLists.txt"
+  "/root/repo/src/core/cominfra/comlayersmanager.cpp.in"
+  "/root/repo/src/core/datatypes/CMakeLists.txt"
+  "/root/repo/src/core/datatypes/convert/CMakeLists.txt"
+  "/root/repo/src/core/deviceExecutionHandlers.cpp.in"
+  "/root/repo/src/core/fmi/CMakeLists.txt"
+  "/root/repo/src/core/io/CMakeLists.txt"
+  "/root/repo/src/core/utils/CMakeLists.txt"
+  "/root/repo/src/modules/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/BistableElements/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Comparison/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BCD/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DT/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Counters/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/EdgeDetection/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Numerical/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Selection/CMakeLists.txt"
+  "/root/repo/src/modules/IEC61131-3/Timers/CMakeLists.txt"
+  "/root/repo/src/modules/PLC01A1/CMakeLists.txt"
+  "/root/repo/src/modules/ads/CMakeLists.txt"
+  "/root/repo/src/modules/arrowhead/CMakeLists.txt"
+  "/root/repo/src/modules/conmeleon_c1/CMakeLists.txt"
+  "/root/repo/src/modules/convert/CMakeLists.txt"
+  "/root/repo/src/modules/embrick/CMakeLists.txt"
+  "/root/repo/src/modules/i2c_dev/CMakeLists.txt"
+  "/root/repo/src/modules/lms_ev3/CMakeLists.txt"
+  "/root/repo/src/modules/mlpi/CMakeLists.txt"
+  "/root/repo/src/modules/odroid/CMakeLists.txt"
+  "/root/repo/src/modules/piface/CMakeLists.txt"
+  "/root/repo/src/modules/raspberry_sps/CMakeLists.txt"
+  "/root/repo/src/modules/reconfiguration/CMakeLists.txt"
+  "/root/repo/src/modules/rt_events/CMakeLists.txt"
+  "/root/repo/src/modules/sysfs/CMakeLists.txt"
+  "/root/repo/src/modules/umic/CMakeLists.txt"
+  "/root/repo/src/modules/utils/CMakeLists.txt"
+  "/root/repo/src/modules/wagokbus/CMakeLists.txt"
+  "/root/repo/src/stdfblib/CMakeLists.txt"
+  "/root/repo/src/stdfblib/events/CMakeLists.txt"
+  "/root/repo/src/stdfblib/ita/CMakeLists.txt"
+  "/root/repo/src/stdfblib/net/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/arch/CMakeLists.txt"
+  "/root/repo/tests/arch/utils/CMakeLists.txt"
+  "/root/repo/tests/core/CMakeLists.txt"
+  "/root/repo/tests/core/cominfra/CMakeLists.txt"
+  "/root/repo/tests/core/datatypes/CIEC_PARTIAL/CMakeLists.txt"
+  "/root/repo/tests/core/datatypes/CMakeLists.txt"
+  "/root/repo/tests/core/datatypes/convert/CMakeLists.txt"
+  "/root/repo/tests/core/fbtests/CMakeLists.txt"
+  "/root/repo/tests/core/utils/CMakeLists.txt"
+  "/root/repo/tests/modules/CMakeLists.txt"
+  "/root/repo/tests/modules/IEC61131-3/CMakeLists.txt"
+  "/root/repo/tests/modules/convert/CMakeLists.txt"
+  "/root/repo/tests/modules/utils/CMakeLists.txt"
+  "/root/repo/tests/stdfblib/CMakeLists.txt"
+  "/root/repo/tests/stdfblib/events/CMakeLists.txt"
+  "/root/repo/tests/stdfblib/ita/CMakeLists.txt"
+  "/root/repo/tools/tracedecoder/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/be_m1/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/ecos/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/ecos/phycoreat91/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/ecos/nios2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/freeRTOS/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/macos/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/netos/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/netos/netos74/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/pikeos_posix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/plcnext/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/posix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/rcX/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/vxworks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/win32/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/cominfra/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/datatypes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/datatypes/convert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/fmi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/BistableElements/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Counters/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/EdgeDetection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Timers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/BOOL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/BYTE/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/DINT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/DWORD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/INT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/SINT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/STRING/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/TIME/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/UDINT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/UINT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/USINT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/WORD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/BCD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/WSTRING/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/REAL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/LREAL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/ULINT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/LWORD/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/LINT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Conversion/DT/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Numerical/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/BitwiseOperators/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Selection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Comparison/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/Arithmetic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/IEC61131-3/CharacterString/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/PLC01A1/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/ads/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/arrowhead/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/conmeleon_c1/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/convert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/embrick/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/i2c_dev/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/lms_ev3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/mlpi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/odroid/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/piface/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/raspberry_sps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/reconfiguration/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/rt_events/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/sysfs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/umic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/modules/wagokbus/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/com/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/com/HTTP/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/com/modbus/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/com/mqtt_paho/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/com/opc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/com/opc_ua/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/com/powerlink/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/com/ros/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/com/tsn/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/com/xquery/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/stdfblib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/stdfblib/events/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/stdfblib/ita/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/stdfblib/net/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/arch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/arch/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/datatypes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/datatypes/CIEC_PARTIAL/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/datatypes/convert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/cominfra/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/fbtests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/core/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/modules/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/modules/convert/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/modules/IEC61131-3/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/modules/utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/stdfblib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/stdfblib/events/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/stdfblib/ita/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tools/tracedecoder/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/forte_stringlist_externals.dir/DependInfo.cmake"
+  "src/CMakeFiles/FORTE_LITE.dir/DependInfo.cmake"
+  "src/CMakeFiles/forte.dir/DependInfo.cmake"
+  "src/CMakeFiles/forte_fboot_converter.dir/DependInfo.cmake"
+  "src/CMakeFiles/forte_init_generator.dir/DependInfo.cmake"
+  "src/CMakeFiles/forte_generate_modules_cmake_files.dir/DependInfo.cmake"
+  "src/CMakeFiles/forte_stringlist_generator.dir/DependInfo.cmake"
+  "tests/CMakeFiles/forte_test.dir/DependInfo.cmake"
+  "tests/CMakeFiles/forte_benchmark.dir/DependInfo.cmake"
+  "tools/tracedecoder/CMakeFiles/forte_trace_decoder.dir/DependInfo.cmake"
+  )
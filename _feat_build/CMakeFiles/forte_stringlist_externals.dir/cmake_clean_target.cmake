@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libforte_stringlist_externals.a"
+)
@@ -0,0 +1,29 @@
+/*******************************************************************************
+ * Copyright (c) 2011 Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Gerhard Ebenhofer
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+#ifndef FORTEINIT_H_
+#define FORTEINIT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void initForte();
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*FORTEINIT_H_*/
@@ -0,0 +1,532 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_feat_build/core/cominfra/comlayersmanager.cpp" "src/CMakeFiles/FORTE_LITE.dir/__/core/cominfra/comlayersmanager.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/__/core/cominfra/comlayersmanager.cpp.o.d"
+  "/root/repo/_feat_build/core/deviceExecutionHandlers.cpp" "src/CMakeFiles/FORTE_LITE.dir/__/core/deviceExecutionHandlers.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/__/core/deviceExecutionHandlers.cpp.o.d"
+  "/root/repo/_feat_build/forteinit.cpp" "src/CMakeFiles/FORTE_LITE.dir/__/forteinit.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/__/forteinit.cpp.o.d"
+  "/root/repo/_feat_build/stringlist.cpp" "src/CMakeFiles/FORTE_LITE.dir/__/stringlist.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/__/stringlist.cpp.o.d"
+  "/root/repo/src/arch/asynclogger.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/asynclogger.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/asynclogger.cpp.o.d"
+  "/root/repo/src/arch/bsdsocketinterf.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/bsdsocketinterf.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/bsdsocketinterf.cpp.o.d"
+  "/root/repo/src/arch/devlog.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/devlog.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/devlog.cpp.o.d"
+  "/root/repo/src/arch/genforte_printer.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/genforte_printer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/genforte_printer.cpp.o.d"
+  "/root/repo/src/arch/genforte_realFunctions.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/genforte_realFunctions.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/genforte_realFunctions.cpp.o.d"
+  "/root/repo/src/arch/posix/epollhand.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/epollhand.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/epollhand.cpp.o.d"
+  "/root/repo/src/arch/posix/forte_architecture_time.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_architecture_time.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_architecture_time.cpp.o.d"
+  "/root/repo/src/arch/posix/forte_sem.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sem.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sem.cpp.o.d"
+  "/root/repo/src/arch/posix/forte_sync.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sync.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sync.cpp.o.d"
+  "/root/repo/src/arch/posix/forte_thread.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_thread.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_thread.cpp.o.d"
+  "/root/repo/src/arch/posix/pctimeha.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/pctimeha.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/pctimeha.cpp.o.d"
+  "/root/repo/src/arch/posix/poolalloc.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/poolalloc.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/poolalloc.cpp.o.d"
+  "/root/repo/src/arch/timerha.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/timerha.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/timerha.cpp.o.d"
+  "/root/repo/src/arch/timingwheel.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/timingwheel.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/timingwheel.cpp.o.d"
+  "/root/repo/src/arch/utils/mainparam_utils.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/utils/mainparam_utils.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/utils/mainparam_utils.cpp.o.d"
+  "/root/repo/src/arch/utils/timespec_utils.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/utils/timespec_utils.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/utils/timespec_utils.cpp.o.d"
+  "/root/repo/src/core/adapter.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/adapter.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/adapter.cpp.o.d"
+  "/root/repo/src/core/adapterconn.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/adapterconn.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/adapterconn.cpp.o.d"
+  "/root/repo/src/core/anyadapter.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/anyadapter.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/anyadapter.cpp.o.d"
+  "/root/repo/src/core/basicfb.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/basicfb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/basicfb.cpp.o.d"
+  "/root/repo/src/core/cfb.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cfb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cfb.cpp.o.d"
+  "/root/repo/src/core/cominfra/basecommfb.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/basecommfb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/basecommfb.cpp.o.d"
+  "/root/repo/src/core/cominfra/comlayer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/comlayer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/comlayer.cpp.o.d"
+  "/root/repo/src/core/cominfra/commfb.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/commfb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/commfb.cpp.o.d"
+  "/root/repo/src/core/cominfra/fbdkasn1layer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/fbdkasn1layer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/fbdkasn1layer.cpp.o.d"
+  "/root/repo/src/core/cominfra/ipcomlayer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/ipcomlayer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/ipcomlayer.cpp.o.d"
+  "/root/repo/src/core/cominfra/localcomlayer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/localcomlayer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/localcomlayer.cpp.o.d"
+  "/root/repo/src/core/cominfra/rawdatacomlayer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/rawdatacomlayer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/rawdatacomlayer.cpp.o.d"
+  "/root/repo/src/core/cominfra/udpsendbatch.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/udpsendbatch.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/udpsendbatch.cpp.o.d"
+  "/root/repo/src/core/conn.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/conn.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/conn.cpp.o.d"
+  "/root/repo/src/core/dataconn.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/dataconn.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/dataconn.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_bit.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_bit.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_bit.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_date.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_date.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_date.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_elementary.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_elementary.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_elementary.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_int.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_int.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_int.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_magnitude.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_magnitude.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_magnitude.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_num.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_num.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_num.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_real.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_real.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_real.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_string.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_string.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_string.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_array.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_array.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_array.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_bool.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_bool.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_bool.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_byte.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_byte.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_byte.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_date.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_date_and_time.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date_and_time.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date_and_time.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_dint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_dword.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dword.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dword.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_int.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_int.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_int.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_lint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_lreal.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lreal.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lreal.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_lword.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lword.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lword.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_real.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_real.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_real.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_sint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_sint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_sint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_string.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_string.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_string.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_struct.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_struct.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_struct.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_time.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_time_of_day.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time_of_day.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time_of_day.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_udint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_udint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_udint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_uint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_uint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_uint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_ulint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_ulint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_ulint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_usint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_usint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_usint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_word.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_word.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_word.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_wstring.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_wstring.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_wstring.cpp.o.d"
+  "/root/repo/src/core/datatypes/unicode_utils.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/unicode_utils.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/unicode_utils.cpp.o.d"
+  "/root/repo/src/core/devexec.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/devexec.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/devexec.cpp.o.d"
+  "/root/repo/src/core/device.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/device.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/device.cpp.o.d"
+  "/root/repo/src/core/ecet.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/ecet.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/ecet.cpp.o.d"
+  "/root/repo/src/core/ecetFactory.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/ecetFactory.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/ecetFactory.cpp.o.d"
+  "/root/repo/src/core/ecetpool.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/ecetpool.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/ecetpool.cpp.o.d"
+  "/root/repo/src/core/eventconn.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/eventconn.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/eventconn.cpp.o.d"
+  "/root/repo/src/core/extevhan.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/extevhan.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/extevhan.cpp.o.d"
+  "/root/repo/src/core/fbcontainer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/fbcontainer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/fbcontainer.cpp.o.d"
+  "/root/repo/src/core/fbportindex.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/fbportindex.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/fbportindex.cpp.o.d"
+  "/root/repo/src/core/funcbloc.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/funcbloc.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/funcbloc.cpp.o.d"
+  "/root/repo/src/core/iec61131_functions.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/iec61131_functions.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/iec61131_functions.cpp.o.d"
+  "/root/repo/src/core/if2indco.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/if2indco.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/if2indco.cpp.o.d"
+  "/root/repo/src/core/monitoring.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/monitoring.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/monitoring.cpp.o.d"
+  "/root/repo/src/core/resource.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/resource.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/resource.cpp.o.d"
+  "/root/repo/src/core/simplefb.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/simplefb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/simplefb.cpp.o.d"
+  "/root/repo/src/core/stringdict.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/stringdict.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/stringdict.cpp.o.d"
+  "/root/repo/src/core/typelib.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/typelib.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/typelib.cpp.o.d"
+  "/root/repo/src/core/utils/alloccheck.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/alloccheck.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/alloccheck.cpp.o.d"
+  "/root/repo/src/core/utils/configFileParser.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/configFileParser.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/configFileParser.cpp.o.d"
+  "/root/repo/src/core/utils/forte_byteswap.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/forte_byteswap.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/forte_byteswap.cpp.o.d"
+  "/root/repo/src/core/utils/parameterParser.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/parameterParser.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/parameterParser.cpp.o.d"
+  "/root/repo/src/core/utils/string_utils.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/string_utils.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/string_utils.cpp.o.d"
+  "/root/repo/src/core/utils/tracepoints.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/tracepoints.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/tracepoints.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_ADD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_ADD_DT_TIME.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD_DT_TIME.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD_DT_TIME.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_ADD_TOD_TIME.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD_TOD_TIME.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD_TOD_TIME.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_DIV.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_DIV.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_DIV.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_DIVTIME.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_DIVTIME.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_DIVTIME.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_EXPT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_EXPT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_EXPT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_MOD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MOD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MOD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_MOVE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MOVE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MOVE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_MUL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MUL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MUL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_MULTIME.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MULTIME.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MULTIME.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_SUB.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_SUB_DATE_DATE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DATE_DATE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DATE_DATE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_SUB_DT_DT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DT_DT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DT_DT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_SUB_DT_TIME.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DT_TIME.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DT_TIME.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_SUB_TOD_TIME.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_TOD_TIME.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_TOD_TIME.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_SUB_TOD_TOD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_TOD_TOD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_TOD_TOD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/F_TRUNC.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_TRUNC.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_TRUNC.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Arithmetic/GEN_ADD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/GEN_ADD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/GEN_ADD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BistableElements/FB_RS.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BistableElements/FB_RS.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BistableElements/FB_RS.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BistableElements/FB_SR.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BistableElements/FB_SR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BistableElements/FB_SR.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/F_AND.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_AND.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_AND.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/F_NOT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_NOT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_NOT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/F_OR.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_OR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_OR.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/F_ROL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_ROL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_ROL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/F_ROR.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_ROR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_ROR.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/F_SHL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_SHL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_SHL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/F_SHR.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_SHR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_SHR.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/F_XOR.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_XOR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_XOR.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/GEN_AND.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_AND.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_AND.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/GEN_OR.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_OR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_OR.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/GEN_XOR.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_XOR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_XOR.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/BitwiseOperators/genbitbase.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/genbitbase.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/genbitbase.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/F_CONCAT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_CONCAT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_CONCAT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/F_CONCAT_DATE_TOD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_CONCAT_DATE_TOD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_CONCAT_DATE_TOD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/F_DELETE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_DELETE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_DELETE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/F_FIND.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_FIND.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_FIND.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/F_INSERT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_INSERT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_INSERT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/F_LEFT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_LEFT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_LEFT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/F_LEN.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_LEN.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_LEN.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/F_MID.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_MID.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_MID.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/F_REPLACE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_REPLACE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_REPLACE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/CharacterString/F_RIGHT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_RIGHT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_RIGHT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Comparison/F_EQ.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_EQ.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_EQ.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Comparison/F_GE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_GE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_GE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Comparison/F_GT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_GT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_GT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Comparison/F_LE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_LE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_LE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Comparison/F_LT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_LT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_LT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Comparison/F_NE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_NE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_NE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BCD/F_BYTE_BCD_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_BYTE_BCD_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_BYTE_BCD_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BCD/F_DWORD_BCD_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_DWORD_BCD_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_DWORD_BCD_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BCD/F_LWORD_BCD_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_LWORD_BCD_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_LWORD_BCD_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BCD/F_UDINT_TO_BCD_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_UDINT_TO_BCD_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_UDINT_TO_BCD_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BCD/F_UINT_TO_BCD_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_UINT_TO_BCD_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_UINT_TO_BCD_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BCD/F_ULINT_TO_BCD_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_ULINT_TO_BCD_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_ULINT_TO_BCD_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BCD/F_USINT_TO_BCD_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_USINT_TO_BCD_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_USINT_TO_BCD_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BCD/F_WORD_BCD_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_WORD_BCD_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_WORD_BCD_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DT/F_DT_TO_DATE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DT/F_DT_TO_DATE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DT/F_DT_TO_DATE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DT/F_DT_TO_TOD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DT/F_DT_TO_TOD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DT/F_DT_TO_TOD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/INT/F_INT_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_BOOL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_BOOL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_BOOL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_TIME.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_TIME.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_TIME.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/TIME/F_TIME_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_WSTRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_BOOL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_BOOL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_BOOL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_BYTE.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_DWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_INT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LREAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LWORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_REAL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_SINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_STRING.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_TIME.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_TIME.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_TIME.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_UINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_USINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_WORD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTD_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTD_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTD_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTD_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTU.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTUD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTUD_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTUD_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTUD_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTU_DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_DINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTU_LINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_LINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_LINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTU_UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_UDINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Counters/FB_CTU_ULINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_ULINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_ULINT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/EdgeDetection/FB_F_TRIG.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/EdgeDetection/FB_F_TRIG.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/EdgeDetection/FB_F_TRIG.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/EdgeDetection/FB_R_TRIG.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/EdgeDetection/FB_R_TRIG.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/EdgeDetection/FB_R_TRIG.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_ABS.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ABS.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ABS.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_ACOS.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ACOS.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ACOS.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_ASIN.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ASIN.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ASIN.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_ATAN.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ATAN.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ATAN.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_COS.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_COS.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_COS.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_EXP.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_EXP.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_EXP.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_LN.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_LN.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_LN.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_LOG.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_LOG.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_LOG.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_SIN.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_SIN.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_SIN.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_SQRT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_SQRT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_SQRT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Numerical/F_TAN.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_TAN.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_TAN.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Selection/F_LIMIT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_LIMIT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_LIMIT.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Selection/F_MAX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MAX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MAX.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Selection/F_MIN.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MIN.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MIN.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Selection/F_MUX_2.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MUX_2.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MUX_2.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Selection/F_SEL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_SEL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_SEL.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Timers/FB_TOF.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TOF.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TOF.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Timers/FB_TON.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TON.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TON.cpp.o.d"
+  "/root/repo/src/modules/IEC61131-3/Timers/FB_TP.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TP.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TP.cpp.o.d"
+  "/root/repo/src/modules/convert/BOOL2BOOL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/BOOL2BOOL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/BOOL2BOOL.cpp.o.d"
+  "/root/repo/src/modules/convert/BYTE2BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/BYTE2BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/BYTE2BYTE.cpp.o.d"
+  "/root/repo/src/modules/convert/DINT2DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/DINT2DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/DINT2DINT.cpp.o.d"
+  "/root/repo/src/modules/convert/DWORD2DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/DWORD2DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/DWORD2DWORD.cpp.o.d"
+  "/root/repo/src/modules/convert/GEN_STRUCT_DEMUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_DEMUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_DEMUX.cpp.o.d"
+  "/root/repo/src/modules/convert/GEN_STRUCT_MUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_MUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_MUX.cpp.o.d"
+  "/root/repo/src/modules/convert/INT2INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/INT2INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/INT2INT.cpp.o.d"
+  "/root/repo/src/modules/convert/LREAL2LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/LREAL2LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/LREAL2LREAL.cpp.o.d"
+  "/root/repo/src/modules/convert/REAL2REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/REAL2REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/REAL2REAL.cpp.o.d"
+  "/root/repo/src/modules/convert/SINT2SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/SINT2SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/SINT2SINT.cpp.o.d"
+  "/root/repo/src/modules/convert/STRING2STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/STRING2STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/STRING2STRING.cpp.o.d"
+  "/root/repo/src/modules/convert/TIME2TIME.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/TIME2TIME.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/TIME2TIME.cpp.o.d"
+  "/root/repo/src/modules/convert/UDINT2UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/UDINT2UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/UDINT2UDINT.cpp.o.d"
+  "/root/repo/src/modules/convert/UINT2UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/UINT2UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/UINT2UINT.cpp.o.d"
+  "/root/repo/src/modules/convert/USINT2USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/USINT2USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/USINT2USINT.cpp.o.d"
+  "/root/repo/src/modules/convert/WORD2WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/WORD2WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/WORD2WORD.cpp.o.d"
+  "/root/repo/src/modules/convert/WSTRING2WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/WSTRING2WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/WSTRING2WSTRING.cpp.o.d"
+  "/root/repo/src/modules/utils/E_STOPWATCH.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/E_STOPWATCH.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/E_STOPWATCH.cpp.o.d"
+  "/root/repo/src/modules/utils/FB_RANDOM.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/FB_RANDOM.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/FB_RANDOM.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_APPEND_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_APPEND_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_APPEND_STRING.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_ARRAY2ARRAY.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2ARRAY.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2ARRAY.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_ARRAY2VALUES.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2VALUES.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2VALUES.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_CSV_WRITER.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_CSV_WRITER.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_CSV_WRITER.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_F_MUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_F_MUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_F_MUX.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_VALUES2ARRAY.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_VALUES2ARRAY.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_VALUES2ARRAY.cpp.o.d"
+  "/root/repo/src/modules/utils/GET_AT_INDEX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GET_AT_INDEX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GET_AT_INDEX.cpp.o.d"
+  "/root/repo/src/modules/utils/GET_STRUCT_VALUE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GET_STRUCT_VALUE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GET_STRUCT_VALUE.cpp.o.d"
+  "/root/repo/src/modules/utils/OUT_ANY_CONSOLE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/OUT_ANY_CONSOLE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/OUT_ANY_CONSOLE.cpp.o.d"
+  "/root/repo/src/modules/utils/SET_AT_INDEX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/SET_AT_INDEX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/SET_AT_INDEX.cpp.o.d"
+  "/root/repo/src/modules/utils/STEST_END.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/STEST_END.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/STEST_END.cpp.o.d"
+  "/root/repo/src/modules/utils/TEST_CONDITION.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/TEST_CONDITION.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/TEST_CONDITION.cpp.o.d"
+  "/root/repo/src/stdfblib/events/ARTimeOut.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/ARTimeOut.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/ARTimeOut.cpp.o.d"
+  "/root/repo/src/stdfblib/events/ATimeOut.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/ATimeOut.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/ATimeOut.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_CTD.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTD.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_CTU.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTU.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTU.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_CTUD.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTUD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTUD.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_CYCLE.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CYCLE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CYCLE.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_DELAY.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DELAY.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DELAY.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_DEMUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DEMUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DEMUX.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_D_FF.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_D_FF.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_D_FF.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_F_TRIG.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_F_TRIG.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_F_TRIG.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_MERGE.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_MERGE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_MERGE.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_PERMIT.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_PERMIT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_PERMIT.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_RDELAY.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RDELAY.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RDELAY.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_REND.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_REND.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_REND.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_RESTART.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RESTART.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RESTART.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_RS.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RS.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RS.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_RTimeOut.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RTimeOut.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RTimeOut.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_R_TRIG.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_R_TRIG.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_R_TRIG.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_SELECT.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SELECT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SELECT.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_SPLIT.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SPLIT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SPLIT.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_SR.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SR.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_SWITCH.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SWITCH.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SWITCH.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_TRAIN.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TRAIN.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TRAIN.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_T_FF.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_T_FF.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_T_FF.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_TimeOut.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TimeOut.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TimeOut.cpp.o.d"
+  "/root/repo/src/stdfblib/events/GEN_E_DEMUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_DEMUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_DEMUX.cpp.o.d"
+  "/root/repo/src/stdfblib/events/GEN_E_MUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_MUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_MUX.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/DEV_MGR.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/DEV_MGR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/DEV_MGR.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/EMB_RES.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/EMB_RES.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/EMB_RES.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/ForteBinaryBootFile.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBinaryBootFile.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBinaryBootFile.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/ForteBootFileLoader.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBootFileLoader.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBootFileLoader.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/RMT_DEV.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_DEV.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_DEV.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/RMT_RES.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_RES.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_RES.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_CLIENT.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_CLIENT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_CLIENT.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_PUBL.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBL.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_PUBLISH.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBLISH.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBLISH.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_SERVER.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SERVER.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SERVER.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_SUBL.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBL.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_SUBSCRIBE.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBSCRIBE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBSCRIBE.cpp.o.d"
+  "/root/repo/src/stdfblib/timedfb.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/timedfb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/timedfb.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
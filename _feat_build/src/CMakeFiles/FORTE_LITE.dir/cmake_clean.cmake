@@ -0,0 +1,1035 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FORTE_LITE.dir/__/core/cominfra/comlayersmanager.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/__/core/cominfra/comlayersmanager.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/__/core/deviceExecutionHandlers.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/__/core/deviceExecutionHandlers.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/__/forteinit.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/__/forteinit.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/__/stringlist.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/__/stringlist.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/asynclogger.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/asynclogger.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/bsdsocketinterf.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/bsdsocketinterf.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/devlog.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/devlog.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/genforte_printer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/genforte_printer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/genforte_realFunctions.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/genforte_realFunctions.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/epollhand.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/epollhand.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_architecture_time.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_architecture_time.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sem.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sem.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sync.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sync.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_thread.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_thread.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/pctimeha.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/pctimeha.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/poolalloc.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/poolalloc.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/timerha.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/timerha.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/timingwheel.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/timingwheel.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/utils/mainparam_utils.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/utils/mainparam_utils.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/utils/timespec_utils.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/utils/timespec_utils.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/adapter.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/adapter.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/adapterconn.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/adapterconn.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/anyadapter.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/anyadapter.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/basicfb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/basicfb.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cfb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cfb.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/basecommfb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/basecommfb.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/comlayer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/comlayer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/commfb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/commfb.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/fbdkasn1layer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/fbdkasn1layer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/ipcomlayer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/ipcomlayer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/localcomlayer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/localcomlayer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/rawdatacomlayer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/rawdatacomlayer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/udpsendbatch.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/udpsendbatch.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/conn.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/conn.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/dataconn.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/dataconn.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_bit.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_bit.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_date.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_date.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_elementary.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_elementary.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_int.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_int.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_magnitude.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_magnitude.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_num.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_num.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_real.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_real.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_string.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_string.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_array.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_array.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_bool.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_bool.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_byte.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_byte.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date_and_time.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date_and_time.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dword.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dword.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_int.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_int.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lreal.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lreal.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lword.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lword.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_real.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_real.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_sint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_sint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_string.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_string.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_struct.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_struct.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time_of_day.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time_of_day.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_udint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_udint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_uint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_uint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_ulint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_ulint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_usint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_usint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_word.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_word.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_wstring.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_wstring.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/unicode_utils.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/unicode_utils.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/devexec.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/devexec.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/device.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/device.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/ecet.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/ecet.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/ecetFactory.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/ecetFactory.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/ecetpool.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/ecetpool.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/eventconn.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/eventconn.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/extevhan.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/extevhan.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/fbcontainer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/fbcontainer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/fbportindex.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/fbportindex.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/funcbloc.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/funcbloc.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/iec61131_functions.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/iec61131_functions.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/if2indco.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/if2indco.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/monitoring.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/monitoring.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/resource.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/resource.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/simplefb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/simplefb.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/stringdict.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/stringdict.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/typelib.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/typelib.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/alloccheck.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/alloccheck.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/configFileParser.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/configFileParser.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/forte_byteswap.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/forte_byteswap.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/parameterParser.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/parameterParser.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/string_utils.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/string_utils.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/tracepoints.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/tracepoints.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD_DT_TIME.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD_DT_TIME.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD_TOD_TIME.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_ADD_TOD_TIME.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_DIV.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_DIV.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_DIVTIME.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_DIVTIME.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_EXPT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_EXPT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MOD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MOD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MOVE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MOVE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MUL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MUL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MULTIME.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_MULTIME.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DATE_DATE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DATE_DATE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DT_DT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DT_DT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DT_TIME.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_DT_TIME.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_TOD_TIME.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_TOD_TIME.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_TOD_TOD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_SUB_TOD_TOD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_TRUNC.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/F_TRUNC.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/GEN_ADD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Arithmetic/GEN_ADD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BistableElements/FB_RS.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BistableElements/FB_RS.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BistableElements/FB_SR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BistableElements/FB_SR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_AND.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_AND.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_NOT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_NOT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_OR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_OR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_ROL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_ROL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_ROR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_ROR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_SHL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_SHL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_SHR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_SHR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_XOR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/F_XOR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_AND.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_AND.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_OR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_OR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_XOR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/GEN_XOR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/genbitbase.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/BitwiseOperators/genbitbase.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_CONCAT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_CONCAT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_CONCAT_DATE_TOD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_CONCAT_DATE_TOD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_DELETE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_DELETE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_FIND.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_FIND.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_INSERT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_INSERT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_LEFT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_LEFT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_LEN.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_LEN.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_MID.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_MID.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_REPLACE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_REPLACE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_RIGHT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/CharacterString/F_RIGHT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_EQ.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_EQ.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_GE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_GE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_GT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_GT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_LE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_LE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_LT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_LT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_NE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Comparison/F_NE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_BYTE_BCD_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_BYTE_BCD_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_DWORD_BCD_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_DWORD_BCD_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_LWORD_BCD_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_LWORD_BCD_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_UDINT_TO_BCD_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_UDINT_TO_BCD_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_UINT_TO_BCD_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_UINT_TO_BCD_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_ULINT_TO_BCD_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_ULINT_TO_BCD_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_USINT_TO_BCD_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_USINT_TO_BCD_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_WORD_BCD_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BCD/F_WORD_BCD_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BOOL/F_BOOL_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/BYTE/F_BYTE_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DINT/F_DINT_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DT/F_DT_TO_DATE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DT/F_DT_TO_DATE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DT/F_DT_TO_TOD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DT/F_DT_TO_TOD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/DWORD/F_DWORD_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/INT/F_INT_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LINT/F_LINT_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LREAL/F_LREAL_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/LWORD/F_LWORD_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/REAL/F_REAL_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/SINT/F_SINT_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_BOOL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_BOOL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_TIME.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_TIME.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/STRING/F_STRING_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_MS_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_NS_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_S_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_IN_US_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/TIME/F_TIME_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UDINT/F_UDINT_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/UINT/F_UINT_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/ULINT/F_ULINT_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/USINT/F_USINT_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WORD/F_WORD_TO_WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_BOOL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_BOOL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_LWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_TIME.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_TIME.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Conversion/WSTRING/F_WSTRING_TO_WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTD_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTUD_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_LINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_LINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_ULINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Counters/FB_CTU_ULINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/EdgeDetection/FB_F_TRIG.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/EdgeDetection/FB_F_TRIG.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/EdgeDetection/FB_R_TRIG.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/EdgeDetection/FB_R_TRIG.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ABS.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ABS.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ACOS.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ACOS.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ASIN.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ASIN.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ATAN.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_ATAN.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_COS.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_COS.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_EXP.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_EXP.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_LN.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_LN.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_LOG.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_LOG.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_SIN.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_SIN.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_SQRT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_SQRT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_TAN.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Numerical/F_TAN.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_LIMIT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_LIMIT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MAX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MAX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MIN.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MIN.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MUX_2.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_MUX_2.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_SEL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Selection/F_SEL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TOF.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TOF.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TON.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TON.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TP.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/IEC61131-3/Timers/FB_TP.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/BOOL2BOOL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/BOOL2BOOL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/BYTE2BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/BYTE2BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/DINT2DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/DINT2DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/DWORD2DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/DWORD2DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_DEMUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_DEMUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_MUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_MUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/INT2INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/INT2INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/LREAL2LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/LREAL2LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/REAL2REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/REAL2REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/SINT2SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/SINT2SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/STRING2STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/STRING2STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/TIME2TIME.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/TIME2TIME.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/UDINT2UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/UDINT2UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/UINT2UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/UINT2UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/USINT2USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/USINT2USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/WORD2WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/WORD2WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/WSTRING2WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/WSTRING2WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/E_STOPWATCH.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/E_STOPWATCH.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/FB_RANDOM.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/FB_RANDOM.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_APPEND_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_APPEND_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2ARRAY.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2ARRAY.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2VALUES.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2VALUES.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_CSV_WRITER.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_CSV_WRITER.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_F_MUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_F_MUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_VALUES2ARRAY.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_VALUES2ARRAY.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GET_AT_INDEX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GET_AT_INDEX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GET_STRUCT_VALUE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GET_STRUCT_VALUE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/OUT_ANY_CONSOLE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/OUT_ANY_CONSOLE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/SET_AT_INDEX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/SET_AT_INDEX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/STEST_END.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/STEST_END.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/TEST_CONDITION.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/TEST_CONDITION.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/ARTimeOut.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/ARTimeOut.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/ATimeOut.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/ATimeOut.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTU.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTU.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTUD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTUD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CYCLE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CYCLE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DELAY.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DELAY.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DEMUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DEMUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_D_FF.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_D_FF.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_F_TRIG.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_F_TRIG.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_MERGE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_MERGE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_PERMIT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_PERMIT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RDELAY.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RDELAY.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_REND.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_REND.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RESTART.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RESTART.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RS.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RS.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RTimeOut.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RTimeOut.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_R_TRIG.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_R_TRIG.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SELECT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SELECT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SPLIT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SPLIT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SWITCH.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SWITCH.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TRAIN.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TRAIN.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_T_FF.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_T_FF.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TimeOut.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TimeOut.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_DEMUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_DEMUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_MUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_MUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/DEV_MGR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/DEV_MGR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/EMB_RES.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/EMB_RES.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBinaryBootFile.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBinaryBootFile.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBootFileLoader.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBootFileLoader.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_DEV.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_DEV.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_RES.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_RES.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_CLIENT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_CLIENT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBLISH.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBLISH.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SERVER.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SERVER.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBSCRIBE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBSCRIBE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/timedfb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/timedfb.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FORTE_LITE.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
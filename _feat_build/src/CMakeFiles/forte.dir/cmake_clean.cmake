@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/forte.dir/arch/posix/main.cpp.o"
+  "CMakeFiles/forte.dir/arch/posix/main.cpp.o.d"
+  "forte"
+  "forte.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/forte.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
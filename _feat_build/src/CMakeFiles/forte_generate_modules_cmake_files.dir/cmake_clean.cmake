@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/forte_generate_modules_cmake_files"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/forte_generate_modules_cmake_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
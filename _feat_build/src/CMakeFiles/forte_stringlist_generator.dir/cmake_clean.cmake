@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/forte_stringlist_generator"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/forte_stringlist_generator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
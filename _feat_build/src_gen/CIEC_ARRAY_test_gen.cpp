@@ -0,0 +1,26 @@
+/*******************************************************************************
+ * Copyright (c) 2012 Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Michael Hofmann
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+ extern const CStringDictionary::TStringId g_nStringIdARRAY;
+ extern const CStringDictionary::TStringId g_nStringIdBOOL;
+ extern const CStringDictionary::TStringId g_nStringIdDINT;
+ extern const CStringDictionary::TStringId g_nStringIdINT;
+ extern const CStringDictionary::TStringId g_nStringIdREAL;
+ extern const CStringDictionary::TStringId g_nStringIdSTRING;
+ extern const CStringDictionary::TStringId g_nStringIdUNDEFINEDDATATYPE;
+ extern const CStringDictionary::TStringId g_nStringIdVal1;
+ extern const CStringDictionary::TStringId g_nStringIdVal2;
+ extern const CStringDictionary::TStringId g_nStringIdVal3;
+ extern const CStringDictionary::TStringId g_nStringIdWSTRING;
+
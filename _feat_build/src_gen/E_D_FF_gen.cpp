@@ -0,0 +1,21 @@
+/*******************************************************************************
+ * Copyright (c) 2012 Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Michael Hofmann
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+ extern const CStringDictionary::TStringId g_nStringIdBOOL;
+ extern const CStringDictionary::TStringId g_nStringIdCLK;
+ extern const CStringDictionary::TStringId g_nStringIdD;
+ extern const CStringDictionary::TStringId g_nStringIdEO;
+ extern const CStringDictionary::TStringId g_nStringIdE_D_FF;
+ extern const CStringDictionary::TStringId g_nStringIdQ;
+
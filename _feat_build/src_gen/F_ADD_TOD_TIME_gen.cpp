@@ -0,0 +1,23 @@
+/*******************************************************************************
+ * Copyright (c) 2012 Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Michael Hofmann
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+ extern const CStringDictionary::TStringId g_nStringIdCNF;
+ extern const CStringDictionary::TStringId g_nStringIdF_ADD_TOD_TIME;
+ extern const CStringDictionary::TStringId g_nStringIdIN1;
+ extern const CStringDictionary::TStringId g_nStringIdIN2;
+ extern const CStringDictionary::TStringId g_nStringIdOUT;
+ extern const CStringDictionary::TStringId g_nStringIdREQ;
+ extern const CStringDictionary::TStringId g_nStringIdTIME;
+ extern const CStringDictionary::TStringId g_nStringIdTIME_OF_DAY;
+
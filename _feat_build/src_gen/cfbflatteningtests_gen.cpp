@@ -0,0 +1,27 @@
+/*******************************************************************************
+ * Copyright (c) 2012 Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Michael Hofmann
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+ extern const CStringDictionary::TStringId g_nStringIdCFB_NESTED_TEST;
+ extern const CStringDictionary::TStringId g_nStringIdCHANGED;
+ extern const CStringDictionary::TStringId g_nStringIdCNF;
+ extern const CStringDictionary::TStringId g_nStringIdIND;
+ extern const CStringDictionary::TStringId g_nStringIdINNER;
+ extern const CStringDictionary::TStringId g_nStringIdOUTER;
+ extern const CStringDictionary::TStringId g_nStringIdQI;
+ extern const CStringDictionary::TStringId g_nStringIdREQ;
+ extern const CStringDictionary::TStringId g_nStringIdRESET;
+ extern const CStringDictionary::TStringId g_nStringIdRSP;
+ extern const CStringDictionary::TStringId g_nStringIdSET;
+ extern const CStringDictionary::TStringId g_nStringIdSR;
+
@@ -0,0 +1,276 @@
+/*******************************************************************************
+ * Copyright (c) 2012 Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Michael Hofmann
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+ extern const CStringDictionary::TStringId g_nStringIdINT;
+ extern const CStringDictionary::TStringId g_nStringIdSTRING;
+ extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_1;
+ extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_2;
+ extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_3;
+ extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_4;
+ extern const CStringDictionary::TStringId g_nStringIdVar0;
+ extern const CStringDictionary::TStringId g_nStringIdVar1;
+ extern const CStringDictionary::TStringId g_nStringIdVar10;
+ extern const CStringDictionary::TStringId g_nStringIdVar100;
+ extern const CStringDictionary::TStringId g_nStringIdVar101;
+ extern const CStringDictionary::TStringId g_nStringIdVar102;
+ extern const CStringDictionary::TStringId g_nStringIdVar103;
+ extern const CStringDictionary::TStringId g_nStringIdVar104;
+ extern const CStringDictionary::TStringId g_nStringIdVar105;
+ extern const CStringDictionary::TStringId g_nStringIdVar106;
+ extern const CStringDictionary::TStringId g_nStringIdVar107;
+ extern const CStringDictionary::TStringId g_nStringIdVar108;
+ extern const CStringDictionary::TStringId g_nStringIdVar109;
+ extern const CStringDictionary::TStringId g_nStringIdVar11;
+ extern const CStringDictionary::TStringId g_nStringIdVar110;
+ extern const CStringDictionary::TStringId g_nStringIdVar111;
+ extern const CStringDictionary::TStringId g_nStringIdVar112;
+ extern const CStringDictionary::TStringId g_nStringIdVar113;
+ extern const CStringDictionary::TStringId g_nStringIdVar114;
+ extern const CStringDictionary::TStringId g_nStringIdVar115;
+ extern const CStringDictionary::TStringId g_nStringIdVar116;
+ extern const CStringDictionary::TStringId g_nStringIdVar117;
+ extern const CStringDictionary::TStringId g_nStringIdVar118;
+ extern const CStringDictionary::TStringId g_nStringIdVar119;
+ extern const CStringDictionary::TStringId g_nStringIdVar12;
+ extern const CStringDictionary::TStringId g_nStringIdVar120;
+ extern const CStringDictionary::TStringId g_nStringIdVar121;
+ extern const CStringDictionary::TStringId g_nStringIdVar122;
+ extern const CStringDictionary::TStringId g_nStringIdVar123;
+ extern const CStringDictionary::TStringId g_nStringIdVar124;
+ extern const CStringDictionary::TStringId g_nStringIdVar125;
+ extern const CStringDictionary::TStringId g_nStringIdVar126;
+ extern const CStringDictionary::TStringId g_nStringIdVar127;
+ extern const CStringDictionary::TStringId g_nStringIdVar128;
+ extern const CStringDictionary::TStringId g_nStringIdVar129;
+ extern const CStringDictionary::TStringId g_nStringIdVar13;
+ extern const CStringDictionary::TStringId g_nStringIdVar130;
+ extern const CStringDictionary::TStringId g_nStringIdVar131;
+ extern const CStringDictionary::TStringId g_nStringIdVar132;
+ extern const CStringDictionary::TStringId g_nStringIdVar133;
+ extern const CStringDictionary::TStringId g_nStringIdVar134;
+ extern const CStringDictionary::TStringId g_nStringIdVar135;
+ extern const CStringDictionary::TStringId g_nStringIdVar136;
+ extern const CStringDictionary::TStringId g_nStringIdVar137;
+ extern const CStringDictionary::TStringId g_nStringIdVar138;
+ extern const CStringDictionary::TStringId g_nStringIdVar139;
+ extern const CStringDictionary::TStringId g_nStringIdVar14;
+ extern const CStringDictionary::TStringId g_nStringIdVar140;
+ extern const CStringDictionary::TStringId g_nStringIdVar141;
+ extern const CStringDictionary::TStringId g_nStringIdVar142;
+ extern const CStringDictionary::TStringId g_nStringIdVar143;
+ extern const CStringDictionary::TStringId g_nStringIdVar144;
+ extern const CStringDictionary::TStringId g_nStringIdVar145;
+ extern const CStringDictionary::TStringId g_nStringIdVar146;
+ extern const CStringDictionary::TStringId g_nStringIdVar147;
+ extern const CStringDictionary::TStringId g_nStringIdVar148;
+ extern const CStringDictionary::TStringId g_nStringIdVar149;
+ extern const CStringDictionary::TStringId g_nStringIdVar15;
+ extern const CStringDictionary::TStringId g_nStringIdVar150;
+ extern const CStringDictionary::TStringId g_nStringIdVar151;
+ extern const CStringDictionary::TStringId g_nStringIdVar152;
+ extern const CStringDictionary::TStringId g_nStringIdVar153;
+ extern const CStringDictionary::TStringId g_nStringIdVar154;
+ extern const CStringDictionary::TStringId g_nStringIdVar155;
+ extern const CStringDictionary::TStringId g_nStringIdVar156;
+ extern const CStringDictionary::TStringId g_nStringIdVar157;
+ extern const CStringDictionary::TStringId g_nStringIdVar158;
+ extern const CStringDictionary::TStringId g_nStringIdVar159;
+ extern const CStringDictionary::TStringId g_nStringIdVar16;
+ extern const CStringDictionary::TStringId g_nStringIdVar160;
+ extern const CStringDictionary::TStringId g_nStringIdVar161;
+ extern const CStringDictionary::TStringId g_nStringIdVar162;
+ extern const CStringDictionary::TStringId g_nStringIdVar163;
+ extern const CStringDictionary::TStringId g_nStringIdVar164;
+ extern const CStringDictionary::TStringId g_nStringIdVar165;
+ extern const CStringDictionary::TStringId g_nStringIdVar166;
+ extern const CStringDictionary::TStringId g_nStringIdVar167;
+ extern const CStringDictionary::TStringId g_nStringIdVar168;
+ extern const CStringDictionary::TStringId g_nStringIdVar169;
+ extern const CStringDictionary::TStringId g_nStringIdVar17;
+ extern const CStringDictionary::TStringId g_nStringIdVar170;
+ extern const CStringDictionary::TStringId g_nStringIdVar171;
+ extern const CStringDictionary::TStringId g_nStringIdVar172;
+ extern const CStringDictionary::TStringId g_nStringIdVar173;
+ extern const CStringDictionary::TStringId g_nStringIdVar174;
+ extern const CStringDictionary::TStringId g_nStringIdVar175;
+ extern const CStringDictionary::TStringId g_nStringIdVar176;
+ extern const CStringDictionary::TStringId g_nStringIdVar177;
+ extern const CStringDictionary::TStringId g_nStringIdVar178;
+ extern const CStringDictionary::TStringId g_nStringIdVar179;
+ extern const CStringDictionary::TStringId g_nStringIdVar18;
+ extern const CStringDictionary::TStringId g_nStringIdVar180;
+ extern const CStringDictionary::TStringId g_nStringIdVar181;
+ extern const CStringDictionary::TStringId g_nStringIdVar182;
+ extern const CStringDictionary::TStringId g_nStringIdVar183;
+ extern const CStringDictionary::TStringId g_nStringIdVar184;
+ extern const CStringDictionary::TStringId g_nStringIdVar185;
+ extern const CStringDictionary::TStringId g_nStringIdVar186;
+ extern const CStringDictionary::TStringId g_nStringIdVar187;
+ extern const CStringDictionary::TStringId g_nStringIdVar188;
+ extern const CStringDictionary::TStringId g_nStringIdVar189;
+ extern const CStringDictionary::TStringId g_nStringIdVar19;
+ extern const CStringDictionary::TStringId g_nStringIdVar190;
+ extern const CStringDictionary::TStringId g_nStringIdVar191;
+ extern const CStringDictionary::TStringId g_nStringIdVar192;
+ extern const CStringDictionary::TStringId g_nStringIdVar193;
+ extern const CStringDictionary::TStringId g_nStringIdVar194;
+ extern const CStringDictionary::TStringId g_nStringIdVar195;
+ extern const CStringDictionary::TStringId g_nStringIdVar196;
+ extern const CStringDictionary::TStringId g_nStringIdVar197;
+ extern const CStringDictionary::TStringId g_nStringIdVar198;
+ extern const CStringDictionary::TStringId g_nStringIdVar199;
+ extern const CStringDictionary::TStringId g_nStringIdVar2;
+ extern const CStringDictionary::TStringId g_nStringIdVar20;
+ extern const CStringDictionary::TStringId g_nStringIdVar200;
+ extern const CStringDictionary::TStringId g_nStringIdVar201;
+ extern const CStringDictionary::TStringId g_nStringIdVar202;
+ extern const CStringDictionary::TStringId g_nStringIdVar203;
+ extern const CStringDictionary::TStringId g_nStringIdVar204;
+ extern const CStringDictionary::TStringId g_nStringIdVar205;
+ extern const CStringDictionary::TStringId g_nStringIdVar206;
+ extern const CStringDictionary::TStringId g_nStringIdVar207;
+ extern const CStringDictionary::TStringId g_nStringIdVar208;
+ extern const CStringDictionary::TStringId g_nStringIdVar209;
+ extern const CStringDictionary::TStringId g_nStringIdVar21;
+ extern const CStringDictionary::TStringId g_nStringIdVar210;
+ extern const CStringDictionary::TStringId g_nStringIdVar211;
+ extern const CStringDictionary::TStringId g_nStringIdVar212;
+ extern const CStringDictionary::TStringId g_nStringIdVar213;
+ extern const CStringDictionary::TStringId g_nStringIdVar214;
+ extern const CStringDictionary::TStringId g_nStringIdVar215;
+ extern const CStringDictionary::TStringId g_nStringIdVar216;
+ extern const CStringDictionary::TStringId g_nStringIdVar217;
+ extern const CStringDictionary::TStringId g_nStringIdVar218;
+ extern const CStringDictionary::TStringId g_nStringIdVar219;
+ extern const CStringDictionary::TStringId g_nStringIdVar22;
+ extern const CStringDictionary::TStringId g_nStringIdVar220;
+ extern const CStringDictionary::TStringId g_nStringIdVar221;
+ extern const CStringDictionary::TStringId g_nStringIdVar222;
+ extern const CStringDictionary::TStringId g_nStringIdVar223;
+ extern const CStringDictionary::TStringId g_nStringIdVar224;
+ extern const CStringDictionary::TStringId g_nStringIdVar225;
+ extern const CStringDictionary::TStringId g_nStringIdVar226;
+ extern const CStringDictionary::TStringId g_nStringIdVar227;
+ extern const CStringDictionary::TStringId g_nStringIdVar228;
+ extern const CStringDictionary::TStringId g_nStringIdVar229;
+ extern const CStringDictionary::TStringId g_nStringIdVar23;
+ extern const CStringDictionary::TStringId g_nStringIdVar230;
+ extern const CStringDictionary::TStringId g_nStringIdVar231;
+ extern const CStringDictionary::TStringId g_nStringIdVar232;
+ extern const CStringDictionary::TStringId g_nStringIdVar233;
+ extern const CStringDictionary::TStringId g_nStringIdVar234;
+ extern const CStringDictionary::TStringId g_nStringIdVar235;
+ extern const CStringDictionary::TStringId g_nStringIdVar236;
+ extern const CStringDictionary::TStringId g_nStringIdVar237;
+ extern const CStringDictionary::TStringId g_nStringIdVar238;
+ extern const CStringDictionary::TStringId g_nStringIdVar239;
+ extern const CStringDictionary::TStringId g_nStringIdVar24;
+ extern const CStringDictionary::TStringId g_nStringIdVar240;
+ extern const CStringDictionary::TStringId g_nStringIdVar241;
+ extern const CStringDictionary::TStringId g_nStringIdVar242;
+ extern const CStringDictionary::TStringId g_nStringIdVar243;
+ extern const CStringDictionary::TStringId g_nStringIdVar244;
+ extern const CStringDictionary::TStringId g_nStringIdVar245;
+ extern const CStringDictionary::TStringId g_nStringIdVar246;
+ extern const CStringDictionary::TStringId g_nStringIdVar247;
+ extern const CStringDictionary::TStringId g_nStringIdVar248;
+ extern const CStringDictionary::TStringId g_nStringIdVar249;
+ extern const CStringDictionary::TStringId g_nStringIdVar25;
+ extern const CStringDictionary::TStringId g_nStringIdVar250;
+ extern const CStringDictionary::TStringId g_nStringIdVar251;
+ extern const CStringDictionary::TStringId g_nStringIdVar252;
+ extern const CStringDictionary::TStringId g_nStringIdVar253;
+ extern const CStringDictionary::TStringId g_nStringIdVar254;
+ extern const CStringDictionary::TStringId g_nStringIdVar26;
+ extern const CStringDictionary::TStringId g_nStringIdVar27;
+ extern const CStringDictionary::TStringId g_nStringIdVar28;
+ extern const CStringDictionary::TStringId g_nStringIdVar29;
+ extern const CStringDictionary::TStringId g_nStringIdVar3;
+ extern const CStringDictionary::TStringId g_nStringIdVar30;
+ extern const CStringDictionary::TStringId g_nStringIdVar31;
+ extern const CStringDictionary::TStringId g_nStringIdVar32;
+ extern const CStringDictionary::TStringId g_nStringIdVar33;
+ extern const CStringDictionary::TStringId g_nStringIdVar34;
+ extern const CStringDictionary::TStringId g_nStringIdVar35;
+ extern const CStringDictionary::TStringId g_nStringIdVar36;
+ extern const CStringDictionary::TStringId g_nStringIdVar37;
+ extern const CStringDictionary::TStringId g_nStringIdVar38;
+ extern const CStringDictionary::TStringId g_nStringIdVar39;
+ extern const CStringDictionary::TStringId g_nStringIdVar4;
+ extern const CStringDictionary::TStringId g_nStringIdVar40;
+ extern const CStringDictionary::TStringId g_nStringIdVar41;
+ extern const CStringDictionary::TStringId g_nStringIdVar42;
+ extern const CStringDictionary::TStringId g_nStringIdVar43;
+ extern const CStringDictionary::TStringId g_nStringIdVar44;
+ extern const CStringDictionary::TStringId g_nStringIdVar45;
+ extern const CStringDictionary::TStringId g_nStringIdVar46;
+ extern const CStringDictionary::TStringId g_nStringIdVar47;
+ extern const CStringDictionary::TStringId g_nStringIdVar48;
+ extern const CStringDictionary::TStringId g_nStringIdVar49;
+ extern const CStringDictionary::TStringId g_nStringIdVar5;
+ extern const CStringDictionary::TStringId g_nStringIdVar50;
+ extern const CStringDictionary::TStringId g_nStringIdVar51;
+ extern const CStringDictionary::TStringId g_nStringIdVar52;
+ extern const CStringDictionary::TStringId g_nStringIdVar53;
+ extern const CStringDictionary::TStringId g_nStringIdVar54;
+ extern const CStringDictionary::TStringId g_nStringIdVar55;
+ extern const CStringDictionary::TStringId g_nStringIdVar56;
+ extern const CStringDictionary::TStringId g_nStringIdVar57;
+ extern const CStringDictionary::TStringId g_nStringIdVar58;
+ extern const CStringDictionary::TStringId g_nStringIdVar59;
+ extern const CStringDictionary::TStringId g_nStringIdVar6;
+ extern const CStringDictionary::TStringId g_nStringIdVar60;
+ extern const CStringDictionary::TStringId g_nStringIdVar61;
+ extern const CStringDictionary::TStringId g_nStringIdVar62;
+ extern const CStringDictionary::TStringId g_nStringIdVar63;
+ extern const CStringDictionary::TStringId g_nStringIdVar64;
+ extern const CStringDictionary::TStringId g_nStringIdVar65;
+ extern const CStringDictionary::TStringId g_nStringIdVar66;
+ extern const CStringDictionary::TStringId g_nStringIdVar67;
+ extern const CStringDictionary::TStringId g_nStringIdVar68;
+ extern const CStringDictionary::TStringId g_nStringIdVar69;
+ extern const CStringDictionary::TStringId g_nStringIdVar7;
+ extern const CStringDictionary::TStringId g_nStringIdVar70;
+ extern const CStringDictionary::TStringId g_nStringIdVar71;
+ extern const CStringDictionary::TStringId g_nStringIdVar72;
+ extern const CStringDictionary::TStringId g_nStringIdVar73;
+ extern const CStringDictionary::TStringId g_nStringIdVar74;
+ extern const CStringDictionary::TStringId g_nStringIdVar75;
+ extern const CStringDictionary::TStringId g_nStringIdVar76;
+ extern const CStringDictionary::TStringId g_nStringIdVar77;
+ extern const CStringDictionary::TStringId g_nStringIdVar78;
+ extern const CStringDictionary::TStringId g_nStringIdVar79;
+ extern const CStringDictionary::TStringId g_nStringIdVar8;
+ extern const CStringDictionary::TStringId g_nStringIdVar80;
+ extern const CStringDictionary::TStringId g_nStringIdVar81;
+ extern const CStringDictionary::TStringId g_nStringIdVar82;
+ extern const CStringDictionary::TStringId g_nStringIdVar83;
+ extern const CStringDictionary::TStringId g_nStringIdVar84;
+ extern const CStringDictionary::TStringId g_nStringIdVar85;
+ extern const CStringDictionary::TStringId g_nStringIdVar86;
+ extern const CStringDictionary::TStringId g_nStringIdVar87;
+ extern const CStringDictionary::TStringId g_nStringIdVar88;
+ extern const CStringDictionary::TStringId g_nStringIdVar89;
+ extern const CStringDictionary::TStringId g_nStringIdVar9;
+ extern const CStringDictionary::TStringId g_nStringIdVar90;
+ extern const CStringDictionary::TStringId g_nStringIdVar91;
+ extern const CStringDictionary::TStringId g_nStringIdVar92;
+ extern const CStringDictionary::TStringId g_nStringIdVar93;
+ extern const CStringDictionary::TStringId g_nStringIdVar94;
+ extern const CStringDictionary::TStringId g_nStringIdVar95;
+ extern const CStringDictionary::TStringId g_nStringIdVar96;
+ extern const CStringDictionary::TStringId g_nStringIdVar97;
+ extern const CStringDictionary::TStringId g_nStringIdVar98;
+ extern const CStringDictionary::TStringId g_nStringIdVar99;
+
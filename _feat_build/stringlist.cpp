@@ -0,0 +1,865 @@
+/*******************************************************************************
+ * Copyright (c) 2010 - 2012 ACIN, Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Michael Hofmann, Alois Zoitl, Ingo Hegny
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+#include "stringlist.h"
+
+extern const CStringDictionary::TStringId g_nStringIdANY = 0;
+extern const CStringDictionary::TStringId g_nStringIdANY_ADAPTER = 4;
+extern const CStringDictionary::TStringId g_nStringIdANY_BIT = 16;
+extern const CStringDictionary::TStringId g_nStringIdANY_ELEMENTARY = 24;
+extern const CStringDictionary::TStringId g_nStringIdANY_INT = 39;
+extern const CStringDictionary::TStringId g_nStringIdANY_MAGNITUDE = 47;
+extern const CStringDictionary::TStringId g_nStringIdANY_NUM = 61;
+extern const CStringDictionary::TStringId g_nStringIdANY_REAL = 69;
+extern const CStringDictionary::TStringId g_nStringIdANY_STRING = 78;
+extern const CStringDictionary::TStringId g_nStringIdARRAY = 89;
+extern const CStringDictionary::TStringId g_nStringIdARTimeOut = 95;
+extern const CStringDictionary::TStringId g_nStringIdATimeOut = 105;
+extern const CStringDictionary::TStringId g_nStringIdArrayOfStructTest = 114;
+extern const CStringDictionary::TStringId g_nStringIdBOOL = 132;
+extern const CStringDictionary::TStringId g_nStringIdBOOL2BOOL = 137;
+extern const CStringDictionary::TStringId g_nStringIdBYTE = 147;
+extern const CStringDictionary::TStringId g_nStringIdBYTE2BYTE = 152;
+extern const CStringDictionary::TStringId g_nStringIdCD = 162;
+extern const CStringDictionary::TStringId g_nStringIdCDO = 165;
+extern const CStringDictionary::TStringId g_nStringIdCFB_NESTED_TEST = 169;
+extern const CStringDictionary::TStringId g_nStringIdCFB_TEST = 185;
+extern const CStringDictionary::TStringId g_nStringIdCHANGED = 194;
+extern const CStringDictionary::TStringId g_nStringIdCLK = 202;
+extern const CStringDictionary::TStringId g_nStringIdCNF = 206;
+extern const CStringDictionary::TStringId g_nStringIdCO = 210;
+extern const CStringDictionary::TStringId g_nStringIdCOLD = 213;
+extern const CStringDictionary::TStringId g_nStringIdCTR = 218;
+extern const CStringDictionary::TStringId g_nStringIdCU = 222;
+extern const CStringDictionary::TStringId g_nStringIdCUO = 225;
+extern const CStringDictionary::TStringId g_nStringIdCV = 229;
+extern const CStringDictionary::TStringId g_nStringIdD = 232;
+extern const CStringDictionary::TStringId g_nStringIdDATE = 234;
+extern const CStringDictionary::TStringId g_nStringIdDATE_AND_TIME = 239;
+extern const CStringDictionary::TStringId g_nStringIdDEV_MGR = 253;
+extern const CStringDictionary::TStringId g_nStringIdDINT = 261;
+extern const CStringDictionary::TStringId g_nStringIdDINT2DINT = 266;
+extern const CStringDictionary::TStringId g_nStringIdDLY = 276;
+extern const CStringDictionary::TStringId g_nStringIdDST = 280;
+extern const CStringDictionary::TStringId g_nStringIdDT = 284;
+extern const CStringDictionary::TStringId g_nStringIdDWORD = 287;
+extern const CStringDictionary::TStringId g_nStringIdDWORD2DWORD = 293;
+extern const CStringDictionary::TStringId g_nStringIdEI = 305;
+extern const CStringDictionary::TStringId g_nStringIdEI0 = 308;
+extern const CStringDictionary::TStringId g_nStringIdEI1 = 312;
+extern const CStringDictionary::TStringId g_nStringIdEI2 = 316;
+extern const CStringDictionary::TStringId g_nStringIdEMB_RES = 320;
+extern const CStringDictionary::TStringId g_nStringIdEO = 328;
+extern const CStringDictionary::TStringId g_nStringIdEO0 = 331;
+extern const CStringDictionary::TStringId g_nStringIdEO1 = 335;
+extern const CStringDictionary::TStringId g_nStringIdEO2 = 339;
+extern const CStringDictionary::TStringId g_nStringIdEO3 = 343;
+extern const CStringDictionary::TStringId g_nStringIdET = 347;
+extern const CStringDictionary::TStringId g_nStringIdE_CTD = 350;
+extern const CStringDictionary::TStringId g_nStringIdE_CTU = 356;
+extern const CStringDictionary::TStringId g_nStringIdE_CTUD = 362;
+extern const CStringDictionary::TStringId g_nStringIdE_CYCLE = 369;
+extern const CStringDictionary::TStringId g_nStringIdE_DELAY = 377;
+extern const CStringDictionary::TStringId g_nStringIdE_DEMUX = 385;
+extern const CStringDictionary::TStringId g_nStringIdE_DEMUX_2 = 393;
+extern const CStringDictionary::TStringId g_nStringIdE_D_FF = 403;
+extern const CStringDictionary::TStringId g_nStringIdE_F_TRIG = 410;
+extern const CStringDictionary::TStringId g_nStringIdE_MERGE = 419;
+extern const CStringDictionary::TStringId g_nStringIdE_MUX_2 = 427;
+extern const CStringDictionary::TStringId g_nStringIdE_PERMIT = 435;
+extern const CStringDictionary::TStringId g_nStringIdE_RDELAY = 444;
+extern const CStringDictionary::TStringId g_nStringIdE_REND = 453;
+extern const CStringDictionary::TStringId g_nStringIdE_RESTART = 460;
+extern const CStringDictionary::TStringId g_nStringIdE_RS = 470;
+extern const CStringDictionary::TStringId g_nStringIdE_RTimeOut = 475;
+extern const CStringDictionary::TStringId g_nStringIdE_R_TRIG = 486;
+extern const CStringDictionary::TStringId g_nStringIdE_SELECT = 495;
+extern const CStringDictionary::TStringId g_nStringIdE_SPLIT = 504;
+extern const CStringDictionary::TStringId g_nStringIdE_SR = 512;
+extern const CStringDictionary::TStringId g_nStringIdE_STOPWATCH = 517;
+extern const CStringDictionary::TStringId g_nStringIdE_SWITCH = 529;
+extern const CStringDictionary::TStringId g_nStringIdE_TRAIN = 538;
+extern const CStringDictionary::TStringId g_nStringIdE_T_FF = 546;
+extern const CStringDictionary::TStringId g_nStringIdE_TimeOut = 553;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTD = 563;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTD_DINT = 570;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTD_LINT = 582;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTD_UDINT = 594;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTD_ULINT = 607;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTU = 620;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTUD = 627;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTUD_DINT = 635;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTUD_LINT = 648;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTUD_ULINT = 661;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTU_DINT = 675;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTU_LINT = 687;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTU_UDINT = 699;
+extern const CStringDictionary::TStringId g_nStringIdFB_CTU_ULINT = 712;
+extern const CStringDictionary::TStringId g_nStringIdFB_F_TRIG = 725;
+extern const CStringDictionary::TStringId g_nStringIdFB_RANDOM = 735;
+extern const CStringDictionary::TStringId g_nStringIdFB_RS = 745;
+extern const CStringDictionary::TStringId g_nStringIdFB_R_TRIG = 751;
+extern const CStringDictionary::TStringId g_nStringIdFB_SR = 761;
+extern const CStringDictionary::TStringId g_nStringIdFB_TOF = 767;
+extern const CStringDictionary::TStringId g_nStringIdFB_TON = 774;
+extern const CStringDictionary::TStringId g_nStringIdFB_TP = 781;
+extern const CStringDictionary::TStringId g_nStringIdFILE_NAME = 787;
+extern const CStringDictionary::TStringId g_nStringIdF_ABS = 797;
+extern const CStringDictionary::TStringId g_nStringIdF_ACOS = 803;
+extern const CStringDictionary::TStringId g_nStringIdF_ADD = 810;
+extern const CStringDictionary::TStringId g_nStringIdF_ADD_DT_TIME = 816;
+extern const CStringDictionary::TStringId g_nStringIdF_ADD_TOD_TIME = 830;
+extern const CStringDictionary::TStringId g_nStringIdF_AND = 845;
+extern const CStringDictionary::TStringId g_nStringIdF_ASIN = 851;
+extern const CStringDictionary::TStringId g_nStringIdF_ATAN = 858;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_BYTE = 865;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_DINT = 880;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_DWORD = 895;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_INT = 911;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_LINT = 925;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_LWORD = 940;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_SINT = 956;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_STRING = 971;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_UDINT = 988;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_UINT = 1004;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_ULINT = 1019;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_USINT = 1035;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_WORD = 1051;
+extern const CStringDictionary::TStringId g_nStringIdF_BOOL_TO_WSTRING = 1066;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_BCD_TO_USINT = 1084;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_DINT = 1104;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_DWORD = 1119;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_INT = 1135;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_LINT = 1149;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_LWORD = 1164;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_SINT = 1180;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_STRING = 1195;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_UDINT = 1212;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_UINT = 1228;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_ULINT = 1243;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_USINT = 1259;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_WORD = 1275;
+extern const CStringDictionary::TStringId g_nStringIdF_BYTE_TO_WSTRING = 1290;
+extern const CStringDictionary::TStringId g_nStringIdF_CONCAT = 1308;
+extern const CStringDictionary::TStringId g_nStringIdF_CONCAT_DATE_TOD = 1317;
+extern const CStringDictionary::TStringId g_nStringIdF_COS = 1335;
+extern const CStringDictionary::TStringId g_nStringIdF_DELETE = 1341;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_BYTE = 1350;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_DWORD = 1365;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_INT = 1381;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_LINT = 1395;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_LREAL = 1410;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_LWORD = 1426;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_REAL = 1442;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_SINT = 1457;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_STRING = 1472;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_UDINT = 1489;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_UINT = 1505;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_ULINT = 1520;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_USINT = 1536;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_WORD = 1552;
+extern const CStringDictionary::TStringId g_nStringIdF_DINT_TO_WSTRING = 1567;
+extern const CStringDictionary::TStringId g_nStringIdF_DIV = 1585;
+extern const CStringDictionary::TStringId g_nStringIdF_DIVTIME = 1591;
+extern const CStringDictionary::TStringId g_nStringIdF_DT_TO_DATE = 1601;
+extern const CStringDictionary::TStringId g_nStringIdF_DT_TO_TOD = 1614;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_BCD_TO_UDINT = 1626;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_BYTE = 1647;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_DINT = 1663;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_INT = 1679;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_LINT = 1694;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_LWORD = 1710;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_REAL = 1727;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_SINT = 1743;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_STRING = 1759;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_UDINT = 1777;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_UINT = 1794;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_ULINT = 1810;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_USINT = 1827;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_WORD = 1844;
+extern const CStringDictionary::TStringId g_nStringIdF_DWORD_TO_WSTRING = 1860;
+extern const CStringDictionary::TStringId g_nStringIdF_EQ = 1879;
+extern const CStringDictionary::TStringId g_nStringIdF_EXP = 1884;
+extern const CStringDictionary::TStringId g_nStringIdF_EXPT = 1890;
+extern const CStringDictionary::TStringId g_nStringIdF_FIND = 1897;
+extern const CStringDictionary::TStringId g_nStringIdF_GE = 1904;
+extern const CStringDictionary::TStringId g_nStringIdF_GT = 1909;
+extern const CStringDictionary::TStringId g_nStringIdF_INSERT = 1914;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_BYTE = 1923;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_DINT = 1937;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_DWORD = 1951;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_LINT = 1966;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_LREAL = 1980;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_LWORD = 1995;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_REAL = 2010;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_SINT = 2024;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_STRING = 2038;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_UDINT = 2054;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_UINT = 2069;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_ULINT = 2083;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_USINT = 2098;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_WORD = 2113;
+extern const CStringDictionary::TStringId g_nStringIdF_INT_TO_WSTRING = 2127;
+extern const CStringDictionary::TStringId g_nStringIdF_LE = 2144;
+extern const CStringDictionary::TStringId g_nStringIdF_LEFT = 2149;
+extern const CStringDictionary::TStringId g_nStringIdF_LEN = 2156;
+extern const CStringDictionary::TStringId g_nStringIdF_LIMIT = 2162;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_BYTE = 2170;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_DINT = 2185;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_DWORD = 2200;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_INT = 2216;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_LREAL = 2230;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_LWORD = 2246;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_REAL = 2262;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_SINT = 2277;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_STRING = 2292;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_UDINT = 2309;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_UINT = 2325;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_ULINT = 2340;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_USINT = 2356;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_WORD = 2372;
+extern const CStringDictionary::TStringId g_nStringIdF_LINT_TO_WSTRING = 2387;
+extern const CStringDictionary::TStringId g_nStringIdF_LN = 2405;
+extern const CStringDictionary::TStringId g_nStringIdF_LOG = 2410;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_DINT = 2416;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_INT = 2432;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_LINT = 2447;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_LWORD = 2463;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_REAL = 2480;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_SINT = 2496;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_STRING = 2512;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_UDINT = 2530;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_UINT = 2547;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_ULINT = 2563;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_USINT = 2580;
+extern const CStringDictionary::TStringId g_nStringIdF_LREAL_TO_WSTRING = 2597;
+extern const CStringDictionary::TStringId g_nStringIdF_LT = 2616;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_BCD_TO_ULINT = 2621;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_BYTE = 2642;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_DINT = 2658;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_DWORD = 2674;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_INT = 2691;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_LINT = 2706;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_LREAL = 2722;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_SINT = 2739;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_STRING = 2755;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_UDINT = 2773;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_UINT = 2790;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_ULINT = 2806;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_USINT = 2823;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_WORD = 2840;
+extern const CStringDictionary::TStringId g_nStringIdF_LWORD_TO_WSTRING = 2856;
+extern const CStringDictionary::TStringId g_nStringIdF_MAX = 2875;
+extern const CStringDictionary::TStringId g_nStringIdF_MID = 2881;
+extern const CStringDictionary::TStringId g_nStringIdF_MIN = 2887;
+extern const CStringDictionary::TStringId g_nStringIdF_MOD = 2893;
+extern const CStringDictionary::TStringId g_nStringIdF_MOVE = 2899;
+extern const CStringDictionary::TStringId g_nStringIdF_MUL = 2906;
+extern const CStringDictionary::TStringId g_nStringIdF_MULTIME = 2912;
+extern const CStringDictionary::TStringId g_nStringIdF_MUX_2 = 2922;
+extern const CStringDictionary::TStringId g_nStringIdF_NE = 2930;
+extern const CStringDictionary::TStringId g_nStringIdF_NOT = 2935;
+extern const CStringDictionary::TStringId g_nStringIdF_OR = 2941;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_DINT = 2946;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_DWORD = 2961;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_INT = 2977;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_LINT = 2991;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_LREAL = 3006;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_SINT = 3022;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_STRING = 3037;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_UDINT = 3054;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_UINT = 3070;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_ULINT = 3085;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_USINT = 3101;
+extern const CStringDictionary::TStringId g_nStringIdF_REAL_TO_WSTRING = 3117;
+extern const CStringDictionary::TStringId g_nStringIdF_REPLACE = 3135;
+extern const CStringDictionary::TStringId g_nStringIdF_RIGHT = 3145;
+extern const CStringDictionary::TStringId g_nStringIdF_ROL = 3153;
+extern const CStringDictionary::TStringId g_nStringIdF_ROR = 3159;
+extern const CStringDictionary::TStringId g_nStringIdF_SEL = 3165;
+extern const CStringDictionary::TStringId g_nStringIdF_SHL = 3171;
+extern const CStringDictionary::TStringId g_nStringIdF_SHR = 3177;
+extern const CStringDictionary::TStringId g_nStringIdF_SIN = 3183;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_BYTE = 3189;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_DINT = 3204;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_DWORD = 3219;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_INT = 3235;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_LINT = 3249;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_LREAL = 3264;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_LWORD = 3280;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_REAL = 3296;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_STRING = 3311;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_UDINT = 3328;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_UINT = 3344;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_ULINT = 3359;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_USINT = 3375;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_WORD = 3391;
+extern const CStringDictionary::TStringId g_nStringIdF_SINT_TO_WSTRING = 3406;
+extern const CStringDictionary::TStringId g_nStringIdF_SQRT = 3424;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_BOOL = 3431;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_BYTE = 3448;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_DINT = 3465;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_DWORD = 3482;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_INT = 3500;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_LINT = 3516;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_LREAL = 3533;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_LWORD = 3551;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_REAL = 3569;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_SINT = 3586;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_TIME = 3603;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_UDINT = 3620;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_UINT = 3638;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_ULINT = 3655;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_USINT = 3673;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_WORD = 3691;
+extern const CStringDictionary::TStringId g_nStringIdF_STRING_TO_WSTRING = 3708;
+extern const CStringDictionary::TStringId g_nStringIdF_SUB = 3728;
+extern const CStringDictionary::TStringId g_nStringIdF_SUB_DATE_DATE = 3734;
+extern const CStringDictionary::TStringId g_nStringIdF_SUB_DT_DT = 3750;
+extern const CStringDictionary::TStringId g_nStringIdF_SUB_DT_TIME = 3762;
+extern const CStringDictionary::TStringId g_nStringIdF_SUB_TOD_TIME = 3776;
+extern const CStringDictionary::TStringId g_nStringIdF_SUB_TOD_TOD = 3791;
+extern const CStringDictionary::TStringId g_nStringIdF_TAN = 3805;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_MS_TO_LINT = 3811;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_MS_TO_LREAL = 3832;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_MS_TO_ULINT = 3854;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_NS_TO_LINT = 3876;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_NS_TO_LREAL = 3897;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_NS_TO_ULINT = 3919;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_S_TO_LINT = 3941;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_S_TO_LREAL = 3961;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_S_TO_ULINT = 3982;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_US_TO_LINT = 4003;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_US_TO_LREAL = 4024;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_IN_US_TO_ULINT = 4046;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_TO_STRING = 4068;
+extern const CStringDictionary::TStringId g_nStringIdF_TIME_TO_WSTRING = 4085;
+extern const CStringDictionary::TStringId g_nStringIdF_TRUNC = 4103;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_BCD_DWORD = 4111;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_BYTE = 4132;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_DINT = 4148;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_DWORD = 4164;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_INT = 4181;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_LINT = 4196;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_LREAL = 4212;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_LWORD = 4229;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_REAL = 4246;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_SINT = 4262;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_STRING = 4278;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_UINT = 4296;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_ULINT = 4312;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_WORD = 4329;
+extern const CStringDictionary::TStringId g_nStringIdF_UDINT_TO_WSTRING = 4345;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_BCD_WORD = 4364;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_BYTE = 4383;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_DINT = 4398;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_DWORD = 4413;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_INT = 4429;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_LINT = 4443;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_LREAL = 4458;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_LWORD = 4474;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_REAL = 4490;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_SINT = 4505;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_STRING = 4520;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_UDINT = 4537;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_ULINT = 4553;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_USINT = 4569;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_WORD = 4585;
+extern const CStringDictionary::TStringId g_nStringIdF_UINT_TO_WSTRING = 4600;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_BCD_LWORD = 4618;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_BYTE = 4639;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_DINT = 4655;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_DWORD = 4671;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_INT = 4688;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_LINT = 4703;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_LREAL = 4719;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_LWORD = 4736;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_REAL = 4753;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_SINT = 4769;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_STRING = 4785;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_UDINT = 4803;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_UINT = 4820;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_USINT = 4836;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_WORD = 4853;
+extern const CStringDictionary::TStringId g_nStringIdF_ULINT_TO_WSTRING = 4869;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_BCD_BYTE = 4888;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_BYTE = 4908;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_DINT = 4924;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_DWORD = 4940;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_INT = 4957;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_LINT = 4972;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_LREAL = 4988;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_LWORD = 5005;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_REAL = 5022;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_SINT = 5038;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_STRING = 5054;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_UDINT = 5072;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_UINT = 5089;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_ULINT = 5105;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_WORD = 5122;
+extern const CStringDictionary::TStringId g_nStringIdF_USINT_TO_WSTRING = 5138;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_BCD_TO_UINT = 5157;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_BYTE = 5176;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_DINT = 5191;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_DWORD = 5206;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_INT = 5222;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_LINT = 5236;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_LWORD = 5251;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_SINT = 5267;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_STRING = 5282;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_UDINT = 5299;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_UINT = 5315;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_ULINT = 5330;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_USINT = 5346;
+extern const CStringDictionary::TStringId g_nStringIdF_WORD_TO_WSTRING = 5362;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_BOOL = 5380;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_BYTE = 5398;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_DINT = 5416;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_DWORD = 5434;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_INT = 5453;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_LINT = 5470;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_LREAL = 5488;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_LWORD = 5507;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_REAL = 5526;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_SINT = 5544;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_STRING = 5562;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_TIME = 5582;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_UDINT = 5600;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_UINT = 5619;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_ULINT = 5637;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_USINT = 5656;
+extern const CStringDictionary::TStringId g_nStringIdF_WSTRING_TO_WORD = 5675;
+extern const CStringDictionary::TStringId g_nStringIdF_XOR = 5693;
+extern const CStringDictionary::TStringId g_nStringIdG = 5699;
+extern const CStringDictionary::TStringId g_nStringIdGATE = 5701;
+extern const CStringDictionary::TStringId g_nStringIdGEN_ADD = 5706;
+extern const CStringDictionary::TStringId g_nStringIdGEN_AND = 5714;
+extern const CStringDictionary::TStringId g_nStringIdGEN_APPEND_STRING = 5722;
+extern const CStringDictionary::TStringId g_nStringIdGEN_ARRAY2ARRAY = 5740;
+extern const CStringDictionary::TStringId g_nStringIdGEN_ARRAY2VALUES = 5756;
+extern const CStringDictionary::TStringId g_nStringIdGEN_CLIENT = 5773;
+extern const CStringDictionary::TStringId g_nStringIdGEN_CSV_WRITER = 5784;
+extern const CStringDictionary::TStringId g_nStringIdGEN_E_DEMUX = 5799;
+extern const CStringDictionary::TStringId g_nStringIdGEN_E_MUX = 5811;
+extern const CStringDictionary::TStringId g_nStringIdGEN_F_MUX = 5821;
+extern const CStringDictionary::TStringId g_nStringIdGEN_OR = 5831;
+extern const CStringDictionary::TStringId g_nStringIdGEN_PUBL = 5838;
+extern const CStringDictionary::TStringId g_nStringIdGEN_PUBLISH = 5847;
+extern const CStringDictionary::TStringId g_nStringIdGEN_SERVER = 5859;
+extern const CStringDictionary::TStringId g_nStringIdGEN_STRUCT_DEMUX = 5870;
+extern const CStringDictionary::TStringId g_nStringIdGEN_STRUCT_MUX = 5887;
+extern const CStringDictionary::TStringId g_nStringIdGEN_SUBL = 5902;
+extern const CStringDictionary::TStringId g_nStringIdGEN_SUBSCRIBE = 5911;
+extern const CStringDictionary::TStringId g_nStringIdGEN_VALUES2ARRAY = 5925;
+extern const CStringDictionary::TStringId g_nStringIdGEN_XOR = 5942;
+extern const CStringDictionary::TStringId g_nStringIdGET_AT_INDEX = 5950;
+extern const CStringDictionary::TStringId g_nStringIdGET_STRUCT_VALUE = 5963;
+extern const CStringDictionary::TStringId g_nStringIdGET_STRUCT_VALUE_Struct_test1 = 5980;
+extern const CStringDictionary::TStringId g_nStringIdGET_STRUCT_VALUE_Struct_test2 = 6010;
+extern const CStringDictionary::TStringId g_nStringIdID = 6040;
+extern const CStringDictionary::TStringId g_nStringIdIN = 6043;
+extern const CStringDictionary::TStringId g_nStringIdIN0 = 6046;
+extern const CStringDictionary::TStringId g_nStringIdIN1 = 6050;
+extern const CStringDictionary::TStringId g_nStringIdIN2 = 6054;
+extern const CStringDictionary::TStringId g_nStringIdIND = 6058;
+extern const CStringDictionary::TStringId g_nStringIdINDEX = 6062;
+extern const CStringDictionary::TStringId g_nStringIdINIT = 6068;
+extern const CStringDictionary::TStringId g_nStringIdINITO = 6073;
+extern const CStringDictionary::TStringId g_nStringIdINNER = 6079;
+extern const CStringDictionary::TStringId g_nStringIdINT = 6085;
+extern const CStringDictionary::TStringId g_nStringIdINT2INT = 6089;
+extern const CStringDictionary::TStringId g_nStringIdIN_ARRAY = 6097;
+extern const CStringDictionary::TStringId g_nStringIdInstanceName = 6106;
+extern const CStringDictionary::TStringId g_nStringIdK = 6119;
+extern const CStringDictionary::TStringId g_nStringIdL = 6121;
+extern const CStringDictionary::TStringId g_nStringIdLABEL = 6123;
+extern const CStringDictionary::TStringId g_nStringIdLD = 6129;
+extern const CStringDictionary::TStringId g_nStringIdLDO = 6132;
+extern const CStringDictionary::TStringId g_nStringIdLINT = 6136;
+extern const CStringDictionary::TStringId g_nStringIdLOWERCASETEST = 6141;
+extern const CStringDictionary::TStringId g_nStringIdLREAL = 6155;
+extern const CStringDictionary::TStringId g_nStringIdLREAL2LREAL = 6161;
+extern const CStringDictionary::TStringId g_nStringIdLWORD = 6173;
+extern const CStringDictionary::TStringId g_nStringIdMGR = 6179;
+extern const CStringDictionary::TStringId g_nStringIdMGR_FF = 6183;
+extern const CStringDictionary::TStringId g_nStringIdMGR_ID = 6190;
+extern const CStringDictionary::TStringId g_nStringIdMN = 6197;
+extern const CStringDictionary::TStringId g_nStringIdMX = 6200;
+extern const CStringDictionary::TStringId g_nStringIdN = 6203;
+extern const CStringDictionary::TStringId g_nStringIdOUT = 6205;
+extern const CStringDictionary::TStringId g_nStringIdOUTER = 6209;
+extern const CStringDictionary::TStringId g_nStringIdOUT_ANY_CONSOLE = 6215;
+extern const CStringDictionary::TStringId g_nStringIdOUT_ARRAY = 6231;
+extern const CStringDictionary::TStringId g_nStringIdP = 6241;
+extern const CStringDictionary::TStringId g_nStringIdPERMIT = 6243;
+extern const CStringDictionary::TStringId g_nStringIdPERMIT_OP = 6250;
+extern const CStringDictionary::TStringId g_nStringIdPT = 6260;
+extern const CStringDictionary::TStringId g_nStringIdPV = 6263;
+extern const CStringDictionary::TStringId g_nStringIdQ = 6266;
+extern const CStringDictionary::TStringId g_nStringIdQ1 = 6268;
+extern const CStringDictionary::TStringId g_nStringIdQD = 6271;
+extern const CStringDictionary::TStringId g_nStringIdQI = 6274;
+extern const CStringDictionary::TStringId g_nStringIdQO = 6277;
+extern const CStringDictionary::TStringId g_nStringIdQU = 6280;
+extern const CStringDictionary::TStringId g_nStringIdR = 6283;
+extern const CStringDictionary::TStringId g_nStringIdR1 = 6285;
+extern const CStringDictionary::TStringId g_nStringIdREAL = 6288;
+extern const CStringDictionary::TStringId g_nStringIdREAL2REAL = 6293;
+extern const CStringDictionary::TStringId g_nStringIdREQ = 6303;
+extern const CStringDictionary::TStringId g_nStringIdRESET = 6307;
+extern const CStringDictionary::TStringId g_nStringIdRESET_CHANGED = 6313;
+extern const CStringDictionary::TStringId g_nStringIdRESP = 6327;
+extern const CStringDictionary::TStringId g_nStringIdRMT_RES = 6332;
+extern const CStringDictionary::TStringId g_nStringIdRO = 6340;
+extern const CStringDictionary::TStringId g_nStringIdRQST = 6343;
+extern const CStringDictionary::TStringId g_nStringIdRSP = 6348;
+extern const CStringDictionary::TStringId g_nStringIdS = 6352;
+extern const CStringDictionary::TStringId g_nStringIdS1 = 6354;
+extern const CStringDictionary::TStringId g_nStringIdSEED = 6357;
+extern const CStringDictionary::TStringId g_nStringIdSET = 6362;
+extern const CStringDictionary::TStringId g_nStringIdSET_AT_INDEX = 6366;
+extern const CStringDictionary::TStringId g_nStringIdSET_CHANGED = 6379;
+extern const CStringDictionary::TStringId g_nStringIdSINT = 6391;
+extern const CStringDictionary::TStringId g_nStringIdSINT2SINT = 6396;
+extern const CStringDictionary::TStringId g_nStringIdSR = 6406;
+extern const CStringDictionary::TStringId g_nStringIdSTART = 6409;
+extern const CStringDictionary::TStringId g_nStringIdSTATUS = 6415;
+extern const CStringDictionary::TStringId g_nStringIdSTEST_END = 6422;
+extern const CStringDictionary::TStringId g_nStringIdSTOP = 6432;
+extern const CStringDictionary::TStringId g_nStringIdSTRING = 6437;
+extern const CStringDictionary::TStringId g_nStringIdSTRING2STRING = 6444;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1REAL = 6458;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1STRING = 6477;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1Struct_Muxer_Test_Struct_1 = 6498;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1Struct_Muxer_Test_Struct_2 = 6539;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1Struct_Muxer_Test_Struct_3 = 6580;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1Struct_Muxer_Test_Struct_4 = 6621;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1UnknownType = 6662;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1REAL = 6688;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1STRING = 6705;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_1 = 6724;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_2 = 6763;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_3 = 6802;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_4 = 6841;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1UnknownType = 6880;
+extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_1 = 6904;
+extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_2 = 6931;
+extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_3 = 6958;
+extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_4 = 6985;
+extern const CStringDictionary::TStringId g_nStringIdTD = 7012;
+extern const CStringDictionary::TStringId g_nStringIdTEST_CONDITION = 7015;
+extern const CStringDictionary::TStringId g_nStringIdTIME = 7030;
+extern const CStringDictionary::TStringId g_nStringIdTIME2TIME = 7035;
+extern const CStringDictionary::TStringId g_nStringIdTIME_OF_DAY = 7045;
+extern const CStringDictionary::TStringId g_nStringIdTestStruct1 = 7057;
+extern const CStringDictionary::TStringId g_nStringIdTestStruct2 = 7069;
+extern const CStringDictionary::TStringId g_nStringIdTestStruct3 = 7081;
+extern const CStringDictionary::TStringId g_nStringIdTestStruct4 = 7093;
+extern const CStringDictionary::TStringId g_nStringIdTimeOut = 7105;
+extern const CStringDictionary::TStringId g_nStringIdTimeOutSocket = 7113;
+extern const CStringDictionary::TStringId g_nStringIdUDINT = 7127;
+extern const CStringDictionary::TStringId g_nStringIdUDINT2UDINT = 7133;
+extern const CStringDictionary::TStringId g_nStringIdUINT = 7145;
+extern const CStringDictionary::TStringId g_nStringIdUINT2UINT = 7150;
+extern const CStringDictionary::TStringId g_nStringIdULINT = 7160;
+extern const CStringDictionary::TStringId g_nStringIdUNDEFINEDDATATYPE = 7166;
+extern const CStringDictionary::TStringId g_nStringIdUSINT = 7184;
+extern const CStringDictionary::TStringId g_nStringIdUSINT2USINT = 7190;
+extern const CStringDictionary::TStringId g_nStringIdVAL = 7202;
+extern const CStringDictionary::TStringId g_nStringIdVALUE = 7206;
+extern const CStringDictionary::TStringId g_nStringIdVal1 = 7212;
+extern const CStringDictionary::TStringId g_nStringIdVal2 = 7217;
+extern const CStringDictionary::TStringId g_nStringIdVal3 = 7222;
+extern const CStringDictionary::TStringId g_nStringIdVal4 = 7227;
+extern const CStringDictionary::TStringId g_nStringIdVar0 = 7232;
+extern const CStringDictionary::TStringId g_nStringIdVar1 = 7237;
+extern const CStringDictionary::TStringId g_nStringIdVar10 = 7242;
+extern const CStringDictionary::TStringId g_nStringIdVar100 = 7248;
+extern const CStringDictionary::TStringId g_nStringIdVar101 = 7255;
+extern const CStringDictionary::TStringId g_nStringIdVar102 = 7262;
+extern const CStringDictionary::TStringId g_nStringIdVar103 = 7269;
+extern const CStringDictionary::TStringId g_nStringIdVar104 = 7276;
+extern const CStringDictionary::TStringId g_nStringIdVar105 = 7283;
+extern const CStringDictionary::TStringId g_nStringIdVar106 = 7290;
+extern const CStringDictionary::TStringId g_nStringIdVar107 = 7297;
+extern const CStringDictionary::TStringId g_nStringIdVar108 = 7304;
+extern const CStringDictionary::TStringId g_nStringIdVar109 = 7311;
+extern const CStringDictionary::TStringId g_nStringIdVar11 = 7318;
+extern const CStringDictionary::TStringId g_nStringIdVar110 = 7324;
+extern const CStringDictionary::TStringId g_nStringIdVar111 = 7331;
+extern const CStringDictionary::TStringId g_nStringIdVar112 = 7338;
+extern const CStringDictionary::TStringId g_nStringIdVar113 = 7345;
+extern const CStringDictionary::TStringId g_nStringIdVar114 = 7352;
+extern const CStringDictionary::TStringId g_nStringIdVar115 = 7359;
+extern const CStringDictionary::TStringId g_nStringIdVar116 = 7366;
+extern const CStringDictionary::TStringId g_nStringIdVar117 = 7373;
+extern const CStringDictionary::TStringId g_nStringIdVar118 = 7380;
+extern const CStringDictionary::TStringId g_nStringIdVar119 = 7387;
+extern const CStringDictionary::TStringId g_nStringIdVar12 = 7394;
+extern const CStringDictionary::TStringId g_nStringIdVar120 = 7400;
+extern const CStringDictionary::TStringId g_nStringIdVar121 = 7407;
+extern const CStringDictionary::TStringId g_nStringIdVar122 = 7414;
+extern const CStringDictionary::TStringId g_nStringIdVar123 = 7421;
+extern const CStringDictionary::TStringId g_nStringIdVar124 = 7428;
+extern const CStringDictionary::TStringId g_nStringIdVar125 = 7435;
+extern const CStringDictionary::TStringId g_nStringIdVar126 = 7442;
+extern const CStringDictionary::TStringId g_nStringIdVar127 = 7449;
+extern const CStringDictionary::TStringId g_nStringIdVar128 = 7456;
+extern const CStringDictionary::TStringId g_nStringIdVar129 = 7463;
+extern const CStringDictionary::TStringId g_nStringIdVar13 = 7470;
+extern const CStringDictionary::TStringId g_nStringIdVar130 = 7476;
+extern const CStringDictionary::TStringId g_nStringIdVar131 = 7483;
+extern const CStringDictionary::TStringId g_nStringIdVar132 = 7490;
+extern const CStringDictionary::TStringId g_nStringIdVar133 = 7497;
+extern const CStringDictionary::TStringId g_nStringIdVar134 = 7504;
+extern const CStringDictionary::TStringId g_nStringIdVar135 = 7511;
+extern const CStringDictionary::TStringId g_nStringIdVar136 = 7518;
+extern const CStringDictionary::TStringId g_nStringIdVar137 = 7525;
+extern const CStringDictionary::TStringId g_nStringIdVar138 = 7532;
+extern const CStringDictionary::TStringId g_nStringIdVar139 = 7539;
+extern const CStringDictionary::TStringId g_nStringIdVar14 = 7546;
+extern const CStringDictionary::TStringId g_nStringIdVar140 = 7552;
+extern const CStringDictionary::TStringId g_nStringIdVar141 = 7559;
+extern const CStringDictionary::TStringId g_nStringIdVar142 = 7566;
+extern const CStringDictionary::TStringId g_nStringIdVar143 = 7573;
+extern const CStringDictionary::TStringId g_nStringIdVar144 = 7580;
+extern const CStringDictionary::TStringId g_nStringIdVar145 = 7587;
+extern const CStringDictionary::TStringId g_nStringIdVar146 = 7594;
+extern const CStringDictionary::TStringId g_nStringIdVar147 = 7601;
+extern const CStringDictionary::TStringId g_nStringIdVar148 = 7608;
+extern const CStringDictionary::TStringId g_nStringIdVar149 = 7615;
+extern const CStringDictionary::TStringId g_nStringIdVar15 = 7622;
+extern const CStringDictionary::TStringId g_nStringIdVar150 = 7628;
+extern const CStringDictionary::TStringId g_nStringIdVar151 = 7635;
+extern const CStringDictionary::TStringId g_nStringIdVar152 = 7642;
+extern const CStringDictionary::TStringId g_nStringIdVar153 = 7649;
+extern const CStringDictionary::TStringId g_nStringIdVar154 = 7656;
+extern const CStringDictionary::TStringId g_nStringIdVar155 = 7663;
+extern const CStringDictionary::TStringId g_nStringIdVar156 = 7670;
+extern const CStringDictionary::TStringId g_nStringIdVar157 = 7677;
+extern const CStringDictionary::TStringId g_nStringIdVar158 = 7684;
+extern const CStringDictionary::TStringId g_nStringIdVar159 = 7691;
+extern const CStringDictionary::TStringId g_nStringIdVar16 = 7698;
+extern const CStringDictionary::TStringId g_nStringIdVar160 = 7704;
+extern const CStringDictionary::TStringId g_nStringIdVar161 = 7711;
+extern const CStringDictionary::TStringId g_nStringIdVar162 = 7718;
+extern const CStringDictionary::TStringId g_nStringIdVar163 = 7725;
+extern const CStringDictionary::TStringId g_nStringIdVar164 = 7732;
+extern const CStringDictionary::TStringId g_nStringIdVar165 = 7739;
+extern const CStringDictionary::TStringId g_nStringIdVar166 = 7746;
+extern const CStringDictionary::TStringId g_nStringIdVar167 = 7753;
+extern const CStringDictionary::TStringId g_nStringIdVar168 = 7760;
+extern const CStringDictionary::TStringId g_nStringIdVar169 = 7767;
+extern const CStringDictionary::TStringId g_nStringIdVar17 = 7774;
+extern const CStringDictionary::TStringId g_nStringIdVar170 = 7780;
+extern const CStringDictionary::TStringId g_nStringIdVar171 = 7787;
+extern const CStringDictionary::TStringId g_nStringIdVar172 = 7794;
+extern const CStringDictionary::TStringId g_nStringIdVar173 = 7801;
+extern const CStringDictionary::TStringId g_nStringIdVar174 = 7808;
+extern const CStringDictionary::TStringId g_nStringIdVar175 = 7815;
+extern const CStringDictionary::TStringId g_nStringIdVar176 = 7822;
+extern const CStringDictionary::TStringId g_nStringIdVar177 = 7829;
+extern const CStringDictionary::TStringId g_nStringIdVar178 = 7836;
+extern const CStringDictionary::TStringId g_nStringIdVar179 = 7843;
+extern const CStringDictionary::TStringId g_nStringIdVar18 = 7850;
+extern const CStringDictionary::TStringId g_nStringIdVar180 = 7856;
+extern const CStringDictionary::TStringId g_nStringIdVar181 = 7863;
+extern const CStringDictionary::TStringId g_nStringIdVar182 = 7870;
+extern const CStringDictionary::TStringId g_nStringIdVar183 = 7877;
+extern const CStringDictionary::TStringId g_nStringIdVar184 = 7884;
+extern const CStringDictionary::TStringId g_nStringIdVar185 = 7891;
+extern const CStringDictionary::TStringId g_nStringIdVar186 = 7898;
+extern const CStringDictionary::TStringId g_nStringIdVar187 = 7905;
+extern const CStringDictionary::TStringId g_nStringIdVar188 = 7912;
+extern const CStringDictionary::TStringId g_nStringIdVar189 = 7919;
+extern const CStringDictionary::TStringId g_nStringIdVar19 = 7926;
+extern const CStringDictionary::TStringId g_nStringIdVar190 = 7932;
+extern const CStringDictionary::TStringId g_nStringIdVar191 = 7939;
+extern const CStringDictionary::TStringId g_nStringIdVar192 = 7946;
+extern const CStringDictionary::TStringId g_nStringIdVar193 = 7953;
+extern const CStringDictionary::TStringId g_nStringIdVar194 = 7960;
+extern const CStringDictionary::TStringId g_nStringIdVar195 = 7967;
+extern const CStringDictionary::TStringId g_nStringIdVar196 = 7974;
+extern const CStringDictionary::TStringId g_nStringIdVar197 = 7981;
+extern const CStringDictionary::TStringId g_nStringIdVar198 = 7988;
+extern const CStringDictionary::TStringId g_nStringIdVar199 = 7995;
+extern const CStringDictionary::TStringId g_nStringIdVar2 = 8002;
+extern const CStringDictionary::TStringId g_nStringIdVar20 = 8007;
+extern const CStringDictionary::TStringId g_nStringIdVar200 = 8013;
+extern const CStringDictionary::TStringId g_nStringIdVar201 = 8020;
+extern const CStringDictionary::TStringId g_nStringIdVar202 = 8027;
+extern const CStringDictionary::TStringId g_nStringIdVar203 = 8034;
+extern const CStringDictionary::TStringId g_nStringIdVar204 = 8041;
+extern const CStringDictionary::TStringId g_nStringIdVar205 = 8048;
+extern const CStringDictionary::TStringId g_nStringIdVar206 = 8055;
+extern const CStringDictionary::TStringId g_nStringIdVar207 = 8062;
+extern const CStringDictionary::TStringId g_nStringIdVar208 = 8069;
+extern const CStringDictionary::TStringId g_nStringIdVar209 = 8076;
+extern const CStringDictionary::TStringId g_nStringIdVar21 = 8083;
+extern const CStringDictionary::TStringId g_nStringIdVar210 = 8089;
+extern const CStringDictionary::TStringId g_nStringIdVar211 = 8096;
+extern const CStringDictionary::TStringId g_nStringIdVar212 = 8103;
+extern const CStringDictionary::TStringId g_nStringIdVar213 = 8110;
+extern const CStringDictionary::TStringId g_nStringIdVar214 = 8117;
+extern const CStringDictionary::TStringId g_nStringIdVar215 = 8124;
+extern const CStringDictionary::TStringId g_nStringIdVar216 = 8131;
+extern const CStringDictionary::TStringId g_nStringIdVar217 = 8138;
+extern const CStringDictionary::TStringId g_nStringIdVar218 = 8145;
+extern const CStringDictionary::TStringId g_nStringIdVar219 = 8152;
+extern const CStringDictionary::TStringId g_nStringIdVar22 = 8159;
+extern const CStringDictionary::TStringId g_nStringIdVar220 = 8165;
+extern const CStringDictionary::TStringId g_nStringIdVar221 = 8172;
+extern const CStringDictionary::TStringId g_nStringIdVar222 = 8179;
+extern const CStringDictionary::TStringId g_nStringIdVar223 = 8186;
+extern const CStringDictionary::TStringId g_nStringIdVar224 = 8193;
+extern const CStringDictionary::TStringId g_nStringIdVar225 = 8200;
+extern const CStringDictionary::TStringId g_nStringIdVar226 = 8207;
+extern const CStringDictionary::TStringId g_nStringIdVar227 = 8214;
+extern const CStringDictionary::TStringId g_nStringIdVar228 = 8221;
+extern const CStringDictionary::TStringId g_nStringIdVar229 = 8228;
+extern const CStringDictionary::TStringId g_nStringIdVar23 = 8235;
+extern const CStringDictionary::TStringId g_nStringIdVar230 = 8241;
+extern const CStringDictionary::TStringId g_nStringIdVar231 = 8248;
+extern const CStringDictionary::TStringId g_nStringIdVar232 = 8255;
+extern const CStringDictionary::TStringId g_nStringIdVar233 = 8262;
+extern const CStringDictionary::TStringId g_nStringIdVar234 = 8269;
+extern const CStringDictionary::TStringId g_nStringIdVar235 = 8276;
+extern const CStringDictionary::TStringId g_nStringIdVar236 = 8283;
+extern const CStringDictionary::TStringId g_nStringIdVar237 = 8290;
+extern const CStringDictionary::TStringId g_nStringIdVar238 = 8297;
+extern const CStringDictionary::TStringId g_nStringIdVar239 = 8304;
+extern const CStringDictionary::TStringId g_nStringIdVar24 = 8311;
+extern const CStringDictionary::TStringId g_nStringIdVar240 = 8317;
+extern const CStringDictionary::TStringId g_nStringIdVar241 = 8324;
+extern const CStringDictionary::TStringId g_nStringIdVar242 = 8331;
+extern const CStringDictionary::TStringId g_nStringIdVar243 = 8338;
+extern const CStringDictionary::TStringId g_nStringIdVar244 = 8345;
+extern const CStringDictionary::TStringId g_nStringIdVar245 = 8352;
+extern const CStringDictionary::TStringId g_nStringIdVar246 = 8359;
+extern const CStringDictionary::TStringId g_nStringIdVar247 = 8366;
+extern const CStringDictionary::TStringId g_nStringIdVar248 = 8373;
+extern const CStringDictionary::TStringId g_nStringIdVar249 = 8380;
+extern const CStringDictionary::TStringId g_nStringIdVar25 = 8387;
+extern const CStringDictionary::TStringId g_nStringIdVar250 = 8393;
+extern const CStringDictionary::TStringId g_nStringIdVar251 = 8400;
+extern const CStringDictionary::TStringId g_nStringIdVar252 = 8407;
+extern const CStringDictionary::TStringId g_nStringIdVar253 = 8414;
+extern const CStringDictionary::TStringId g_nStringIdVar254 = 8421;
+extern const CStringDictionary::TStringId g_nStringIdVar26 = 8428;
+extern const CStringDictionary::TStringId g_nStringIdVar27 = 8434;
+extern const CStringDictionary::TStringId g_nStringIdVar28 = 8440;
+extern const CStringDictionary::TStringId g_nStringIdVar29 = 8446;
+extern const CStringDictionary::TStringId g_nStringIdVar3 = 8452;
+extern const CStringDictionary::TStringId g_nStringIdVar30 = 8457;
+extern const CStringDictionary::TStringId g_nStringIdVar31 = 8463;
+extern const CStringDictionary::TStringId g_nStringIdVar32 = 8469;
+extern const CStringDictionary::TStringId g_nStringIdVar33 = 8475;
+extern const CStringDictionary::TStringId g_nStringIdVar34 = 8481;
+extern const CStringDictionary::TStringId g_nStringIdVar35 = 8487;
+extern const CStringDictionary::TStringId g_nStringIdVar36 = 8493;
+extern const CStringDictionary::TStringId g_nStringIdVar37 = 8499;
+extern const CStringDictionary::TStringId g_nStringIdVar38 = 8505;
+extern const CStringDictionary::TStringId g_nStringIdVar39 = 8511;
+extern const CStringDictionary::TStringId g_nStringIdVar4 = 8517;
+extern const CStringDictionary::TStringId g_nStringIdVar40 = 8522;
+extern const CStringDictionary::TStringId g_nStringIdVar41 = 8528;
+extern const CStringDictionary::TStringId g_nStringIdVar42 = 8534;
+extern const CStringDictionary::TStringId g_nStringIdVar43 = 8540;
+extern const CStringDictionary::TStringId g_nStringIdVar44 = 8546;
+extern const CStringDictionary::TStringId g_nStringIdVar45 = 8552;
+extern const CStringDictionary::TStringId g_nStringIdVar46 = 8558;
+extern const CStringDictionary::TStringId g_nStringIdVar47 = 8564;
+extern const CStringDictionary::TStringId g_nStringIdVar48 = 8570;
+extern const CStringDictionary::TStringId g_nStringIdVar49 = 8576;
+extern const CStringDictionary::TStringId g_nStringIdVar5 = 8582;
+extern const CStringDictionary::TStringId g_nStringIdVar50 = 8587;
+extern const CStringDictionary::TStringId g_nStringIdVar51 = 8593;
+extern const CStringDictionary::TStringId g_nStringIdVar52 = 8599;
+extern const CStringDictionary::TStringId g_nStringIdVar53 = 8605;
+extern const CStringDictionary::TStringId g_nStringIdVar54 = 8611;
+extern const CStringDictionary::TStringId g_nStringIdVar55 = 8617;
+extern const CStringDictionary::TStringId g_nStringIdVar56 = 8623;
+extern const CStringDictionary::TStringId g_nStringIdVar57 = 8629;
+extern const CStringDictionary::TStringId g_nStringIdVar58 = 8635;
+extern const CStringDictionary::TStringId g_nStringIdVar59 = 8641;
+extern const CStringDictionary::TStringId g_nStringIdVar6 = 8647;
+extern const CStringDictionary::TStringId g_nStringIdVar60 = 8652;
+extern const CStringDictionary::TStringId g_nStringIdVar61 = 8658;
+extern const CStringDictionary::TStringId g_nStringIdVar62 = 8664;
+extern const CStringDictionary::TStringId g_nStringIdVar63 = 8670;
+extern const CStringDictionary::TStringId g_nStringIdVar64 = 8676;
+extern const CStringDictionary::TStringId g_nStringIdVar65 = 8682;
+extern const CStringDictionary::TStringId g_nStringIdVar66 = 8688;
+extern const CStringDictionary::TStringId g_nStringIdVar67 = 8694;
+extern const CStringDictionary::TStringId g_nStringIdVar68 = 8700;
+extern const CStringDictionary::TStringId g_nStringIdVar69 = 8706;
+extern const CStringDictionary::TStringId g_nStringIdVar7 = 8712;
+extern const CStringDictionary::TStringId g_nStringIdVar70 = 8717;
+extern const CStringDictionary::TStringId g_nStringIdVar71 = 8723;
+extern const CStringDictionary::TStringId g_nStringIdVar72 = 8729;
+extern const CStringDictionary::TStringId g_nStringIdVar73 = 8735;
+extern const CStringDictionary::TStringId g_nStringIdVar74 = 8741;
+extern const CStringDictionary::TStringId g_nStringIdVar75 = 8747;
+extern const CStringDictionary::TStringId g_nStringIdVar76 = 8753;
+extern const CStringDictionary::TStringId g_nStringIdVar77 = 8759;
+extern const CStringDictionary::TStringId g_nStringIdVar78 = 8765;
+extern const CStringDictionary::TStringId g_nStringIdVar79 = 8771;
+extern const CStringDictionary::TStringId g_nStringIdVar8 = 8777;
+extern const CStringDictionary::TStringId g_nStringIdVar80 = 8782;
+extern const CStringDictionary::TStringId g_nStringIdVar81 = 8788;
+extern const CStringDictionary::TStringId g_nStringIdVar82 = 8794;
+extern const CStringDictionary::TStringId g_nStringIdVar83 = 8800;
+extern const CStringDictionary::TStringId g_nStringIdVar84 = 8806;
+extern const CStringDictionary::TStringId g_nStringIdVar85 = 8812;
+extern const CStringDictionary::TStringId g_nStringIdVar86 = 8818;
+extern const CStringDictionary::TStringId g_nStringIdVar87 = 8824;
+extern const CStringDictionary::TStringId g_nStringIdVar88 = 8830;
+extern const CStringDictionary::TStringId g_nStringIdVar89 = 8836;
+extern const CStringDictionary::TStringId g_nStringIdVar9 = 8842;
+extern const CStringDictionary::TStringId g_nStringIdVar90 = 8847;
+extern const CStringDictionary::TStringId g_nStringIdVar91 = 8853;
+extern const CStringDictionary::TStringId g_nStringIdVar92 = 8859;
+extern const CStringDictionary::TStringId g_nStringIdVar93 = 8865;
+extern const CStringDictionary::TStringId g_nStringIdVar94 = 8871;
+extern const CStringDictionary::TStringId g_nStringIdVar95 = 8877;
+extern const CStringDictionary::TStringId g_nStringIdVar96 = 8883;
+extern const CStringDictionary::TStringId g_nStringIdVar97 = 8889;
+extern const CStringDictionary::TStringId g_nStringIdVar98 = 8895;
+extern const CStringDictionary::TStringId g_nStringIdVar99 = 8901;
+extern const CStringDictionary::TStringId g_nStringIdWARM = 8907;
+extern const CStringDictionary::TStringId g_nStringIdWORD = 8912;
+extern const CStringDictionary::TStringId g_nStringIdWORD2WORD = 8917;
+extern const CStringDictionary::TStringId g_nStringIdWSTRING = 8927;
+extern const CStringDictionary::TStringId g_nStringIdWSTRING2WSTRING = 8935;
+extern const CStringDictionary::TStringId g_nStringIdcheck = 8951;
+extern const CStringDictionary::TStringId g_nStringIdin_struct = 8957;
+extern const CStringDictionary::TStringId g_nStringIdlowercasetest = 8967;
+extern const CStringDictionary::TStringId g_nStringIdmember = 8981;
+extern const CStringDictionary::TStringId g_nStringIdoutput = 8988;
+extern const CStringDictionary::TStringId g_nStringIdstartTime = 8995;
+extern const CStringDictionary::TStringId g_nStringIdwARM = 9005;
+extern const CStringDictionary::TStringId g_nStringIdNextFreeId = 9010;
+extern const unsigned int cg_nNumOfConstStrings = 835;
+
+
+const CStringDictionary::TStringId CStringDictionary::scm_aunIdList[] = {0, 4, 16, 24, 39, 47, 61, 69, 78, 89, 95, 105, 114, 132, 137, 147, 152, 162, 165, 169, 185, 194, 202, 206, 210, 213, 218, 222, 225, 229, 232, 234, 239, 253, 261, 266, 276, 280, 284, 287, 293, 305, 308, 312, 316, 320, 328, 331, 335, 339, 343, 347, 350, 356, 362, 369, 377, 385, 393, 403, 410, 419, 427, 435, 444, 453, 460, 470, 475, 486, 495, 504, 512, 517, 529, 538, 546, 553, 563, 570, 582, 594, 607, 620, 627, 635, 648, 661, 675, 687, 699, 712, 725, 735, 745, 751, 761, 767, 774, 781, 787, 797, 803, 810, 816, 830, 845, 851, 858, 865, 880, 895, 911, 925, 940, 956, 971, 988, 1004, 1019, 1035, 1051, 1066, 1084, 1104, 1119, 1135, 1149, 1164, 1180, 1195, 1212, 1228, 1243, 1259, 1275, 1290, 1308, 1317, 1335, 1341, 1350, 1365, 1381, 1395, 1410, 1426, 1442, 1457, 1472, 1489, 1505, 1520, 1536, 1552, 1567, 1585, 1591, 1601, 1614, 1626, 1647, 1663, 1679, 1694, 1710, 1727, 1743, 1759, 1777, 1794, 1810, 1827, 1844, 1860, 1879, 1884, 1890, 1897, 1904, 1909, 1914, 1923, 1937, 1951, 1966, 1980, 1995, 2010, 2024, 2038, 2054, 2069, 2083, 2098, 2113, 2127, 2144, 2149, 2156, 2162, 2170, 2185, 2200, 2216, 2230, 2246, 2262, 2277, 2292, 2309, 2325, 2340, 2356, 2372, 2387, 2405, 2410, 2416, 2432, 2447, 2463, 2480, 2496, 2512, 2530, 2547, 2563, 2580, 2597, 2616, 2621, 2642, 2658, 2674, 2691, 2706, 2722, 2739, 2755, 2773, 2790, 2806, 2823, 2840, 2856, 2875, 2881, 2887, 2893, 2899, 2906, 2912, 2922, 2930, 2935, 2941, 2946, 2961, 2977, 2991, 3006, 3022, 3037, 3054, 3070, 3085, 3101, 3117, 3135, 3145, 3153, 3159, 3165, 3171, 3177, 3183, 3189, 3204, 3219, 3235, 3249, 3264, 3280, 3296, 3311, 3328, 3344, 3359, 3375, 3391, 3406, 3424, 3431, 3448, 3465, 3482, 3500, 3516, 3533, 3551, 3569, 3586, 3603, 3620, 3638, 3655, 3673, 3691, 3708, 3728, 3734, 3750, 3762, 3776, 3791, 3805, 3811, 3832, 3854, 3876, 3897, 3919, 3941, 3961, 3982, 4003, 4024, 4046, 4068, 4085, 4103, 4111, 4132, 4148, 4164, 4181, 4196, 4212, 4229, 4246, 4262, 4278, 4296, 4312, 4329, 4345, 4364, 4383, 4398, 4413, 4429, 4443, 4458, 4474, 4490, 4505, 4520, 4537, 4553, 4569, 4585, 4600, 4618, 4639, 4655, 4671, 4688, 4703, 4719, 4736, 4753, 4769, 4785, 4803, 4820, 4836, 4853, 4869, 4888, 4908, 4924, 4940, 4957, 4972, 4988, 5005, 5022, 5038, 5054, 5072, 5089, 5105, 5122, 5138, 5157, 5176, 5191, 5206, 5222, 5236, 5251, 5267, 5282, 5299, 5315, 5330, 5346, 5362, 5380, 5398, 5416, 5434, 5453, 5470, 5488, 5507, 5526, 5544, 5562, 5582, 5600, 5619, 5637, 5656, 5675, 5693, 5699, 5701, 5706, 5714, 5722, 5740, 5756, 5773, 5784, 5799, 5811, 5821, 5831, 5838, 5847, 5859, 5870, 5887, 5902, 5911, 5925, 5942, 5950, 5963, 5980, 6010, 6040, 6043, 6046, 6050, 6054, 6058, 6062, 6068, 6073, 6079, 6085, 6089, 6097, 6106, 6119, 6121, 6123, 6129, 6132, 6136, 6141, 6155, 6161, 6173, 6179, 6183, 6190, 6197, 6200, 6203, 6205, 6209, 6215, 6231, 6241, 6243, 6250, 6260, 6263, 6266, 6268, 6271, 6274, 6277, 6280, 6283, 6285, 6288, 6293, 6303, 6307, 6313, 6327, 6332, 6340, 6343, 6348, 6352, 6354, 6357, 6362, 6366, 6379, 6391, 6396, 6406, 6409, 6415, 6422, 6432, 6437, 6444, 6458, 6477, 6498, 6539, 6580, 6621, 6662, 6688, 6705, 6724, 6763, 6802, 6841, 6880, 6904, 6931, 6958, 6985, 7012, 7015, 7030, 7035, 7045, 7057, 7069, 7081, 7093, 7105, 7113, 7127, 7133, 7145, 7150, 7160, 7166, 7184, 7190, 7202, 7206, 7212, 7217, 7222, 7227, 7232, 7237, 7242, 7248, 7255, 7262, 7269, 7276, 7283, 7290, 7297, 7304, 7311, 7318, 7324, 7331, 7338, 7345, 7352, 7359, 7366, 7373, 7380, 7387, 7394, 7400, 7407, 7414, 7421, 7428, 7435, 7442, 7449, 7456, 7463, 7470, 7476, 7483, 7490, 7497, 7504, 7511, 7518, 7525, 7532, 7539, 7546, 7552, 7559, 7566, 7573, 7580, 7587, 7594, 7601, 7608, 7615, 7622, 7628, 7635, 7642, 7649, 7656, 7663, 7670, 7677, 7684, 7691, 7698, 7704, 7711, 7718, 7725, 7732, 7739, 7746, 7753, 7760, 7767, 7774, 7780, 7787, 7794, 7801, 7808, 7815, 7822, 7829, 7836, 7843, 7850, 7856, 7863, 7870, 7877, 7884, 7891, 7898, 7905, 7912, 7919, 7926, 7932, 7939, 7946, 7953, 7960, 7967, 7974, 7981, 7988, 7995, 8002, 8007, 8013, 8020, 8027, 8034, 8041, 8048, 8055, 8062, 8069, 8076, 8083, 8089, 8096, 8103, 8110, 8117, 8124, 8131, 8138, 8145, 8152, 8159, 8165, 8172, 8179, 8186, 8193, 8200, 8207, 8214, 8221, 8228, 8235, 8241, 8248, 8255, 8262, 8269, 8276, 8283, 8290, 8297, 8304, 8311, 8317, 8324, 8331, 8338, 8345, 8352, 8359, 8366, 8373, 8380, 8387, 8393, 8400, 8407, 8414, 8421, 8428, 8434, 8440, 8446, 8452, 8457, 8463, 8469, 8475, 8481, 8487, 8493, 8499, 8505, 8511, 8517, 8522, 8528, 8534, 8540, 8546, 8552, 8558, 8564, 8570, 8576, 8582, 8587, 8593, 8599, 8605, 8611, 8617, 8623, 8629, 8635, 8641, 8647, 8652, 8658, 8664, 8670, 8676, 8682, 8688, 8694, 8700, 8706, 8712, 8717, 8723, 8729, 8735, 8741, 8747, 8753, 8759, 8765, 8771, 8777, 8782, 8788, 8794, 8800, 8806, 8812, 8818, 8824, 8830, 8836, 8842, 8847, 8853, 8859, 8865, 8871, 8877, 8883, 8889, 8895, 8901, 8907, 8912, 8917, 8927, 8935, 8951, 8957, 8967, 8981, 8988, 8995, 9005};
+
+#ifdef FORTE_STRING_DICT_FIXED_MEMORY
+  char CStringDictionary::scm_acConstStringBuf[cg_unStringDictInitialStringBufSize]
+#else
+  const char CStringDictionary::scm_acConstStringBuf[] 
+#endif
+  = {"ANY\0ANY_ADAPTER\0ANY_BIT\0ANY_ELEMENTARY\0ANY_INT\0ANY_MAGNITUDE\0ANY_NUM\0ANY_REAL\0ANY_STRING\0ARRAY\0ARTimeOut\0ATimeOut\0ArrayOfStructTest\0BOOL\0BOOL2BOOL\0BYTE\0BYTE2BYTE\0CD\0CDO\0CFB_NESTED_TEST\0CFB_TEST\0CHANGED\0CLK\0CNF\0CO\0COLD\0CTR\0CU\0CUO\0CV\0D\0DATE\0DATE_AND_TIME\0DEV_MGR\0DINT\0DINT2DINT\0DLY\0DST\0DT\0DWORD\0DWORD2DWORD\0EI\0EI0\0EI1\0EI2\0EMB_RES\0EO\0EO0\0EO1\0EO2\0EO3\0ET\0E_CTD\0E_CTU\0E_CTUD\0E_CYCLE\0E_DELAY\0E_DEMUX\0E_DEMUX_2\0E_D_FF\0E_F_TRIG\0E_MERGE\0E_MUX_2\0E_PERMIT\0E_RDELAY\0E_REND\0E_RESTART\0E_RS\0E_RTimeOut\0E_R_TRIG\0E_SELECT\0E_SPLIT\0E_SR\0E_STOPWATCH\0E_SWITCH\0E_TRAIN\0E_T_FF\0E_TimeOut\0FB_CTD\0FB_CTD_DINT\0FB_CTD_LINT\0FB_CTD_UDINT\0FB_CTD_ULINT\0FB_CTU\0FB_CTUD\0FB_CTUD_DINT\0FB_CTUD_LINT\0FB_CTUD_ULINT\0FB_CTU_DINT\0FB_CTU_LINT\0FB_CTU_UDINT\0FB_CTU_ULINT\0FB_F_TRIG\0FB_RANDOM\0FB_RS\0FB_R_TRIG\0FB_SR\0FB_TOF\0FB_TON\0FB_TP\0FILE_NAME\0F_ABS\0F_ACOS\0F_ADD\0F_ADD_DT_TIME\0F_ADD_TOD_TIME\0F_AND\0F_ASIN\0F_ATAN\0F_BOOL_TO_BYTE\0F_BOOL_TO_DINT\0F_BOOL_TO_DWORD\0F_BOOL_TO_INT\0F_BOOL_TO_LINT\0F_BOOL_TO_LWORD\0F_BOOL_TO_SINT\0F_BOOL_TO_STRING\0F_BOOL_TO_UDINT\0F_BOOL_TO_UINT\0F_BOOL_TO_ULINT\0F_BOOL_TO_USINT\0F_BOOL_TO_WORD\0F_BOOL_TO_WSTRING\0F_BYTE_BCD_TO_USINT\0F_BYTE_TO_DINT\0F_BYTE_TO_DWORD\0F_BYTE_TO_INT\0F_BYTE_TO_LINT\0F_BYTE_TO_LWORD\0F_BYTE_TO_SINT\0F_BYTE_TO_STRING\0F_BYTE_TO_UDINT\0F_BYTE_TO_UINT\0F_BYTE_TO_ULINT\0F_BYTE_TO_USINT\0F_BYTE_TO_WORD\0F_BYTE_TO_WSTRING\0F_CONCAT\0F_CONCAT_DATE_TOD\0F_COS\0F_DELETE\0F_DINT_TO_BYTE\0F_DINT_TO_DWORD\0F_DINT_TO_INT\0F_DINT_TO_LINT\0F_DINT_TO_LREAL\0F_DINT_TO_LWORD\0F_DINT_TO_REAL\0F_DINT_TO_SINT\0F_DINT_TO_STRING\0F_DINT_TO_UDINT\0F_DINT_TO_UINT\0F_DINT_TO_ULINT\0F_DINT_TO_USINT\0F_DINT_TO_WORD\0F_DINT_TO_WSTRING\0F_DIV\0F_DIVTIME\0F_DT_TO_DATE\0F_DT_TO_TOD\0F_DWORD_BCD_TO_UDINT\0F_DWORD_TO_BYTE\0F_DWORD_TO_DINT\0F_DWORD_TO_INT\0F_DWORD_TO_LINT\0F_DWORD_TO_LWORD\0F_DWORD_TO_REAL\0F_DWORD_TO_SINT\0F_DWORD_TO_STRING\0F_DWORD_TO_UDINT\0F_DWORD_TO_UINT\0F_DWORD_TO_ULINT\0F_DWORD_TO_USINT\0F_DWORD_TO_WORD\0F_DWORD_TO_WSTRING\0F_EQ\0F_EXP\0F_EXPT\0F_FIND\0F_GE\0F_GT\0F_INSERT\0F_INT_TO_BYTE\0F_INT_TO_DINT\0F_INT_TO_DWORD\0F_INT_TO_LINT\0F_INT_TO_LREAL\0F_INT_TO_LWORD\0F_INT_TO_REAL\0F_INT_TO_SINT\0F_INT_TO_STRING\0F_INT_TO_UDINT\0F_INT_TO_UINT\0F_INT_TO_ULINT\0F_INT_TO_USINT\0F_INT_TO_WORD\0F_INT_TO_WSTRING\0F_LE\0F_LEFT\0F_LEN\0F_LIMIT\0F_LINT_TO_BYTE\0F_LINT_TO_DINT\0F_LINT_TO_DWORD\0F_LINT_TO_INT\0F_LINT_TO_LREAL\0F_LINT_TO_LWORD\0F_LINT_TO_REAL\0F_LINT_TO_SINT\0F_LINT_TO_STRING\0F_LINT_TO_UDINT\0F_LINT_TO_UINT\0F_LINT_TO_ULINT\0F_LINT_TO_USINT\0F_LINT_TO_WORD\0F_LINT_TO_WSTRING\0F_LN\0F_LOG\0F_LREAL_TO_DINT\0F_LREAL_TO_INT\0F_LREAL_TO_LINT\0F_LREAL_TO_LWORD\0F_LREAL_TO_REAL\0F_LREAL_TO_SINT\0F_LREAL_TO_STRING\0F_LREAL_TO_UDINT\0F_LREAL_TO_UINT\0F_LREAL_TO_ULINT\0F_LREAL_TO_USINT\0F_LREAL_TO_WSTRING\0F_LT\0F_LWORD_BCD_TO_ULINT\0F_LWORD_TO_BYTE\0F_LWORD_TO_DINT\0F_LWORD_TO_DWORD\0F_LWORD_TO_INT\0F_LWORD_TO_LINT\0F_LWORD_TO_LREAL\0F_LWORD_TO_SINT\0F_LWORD_TO_STRING\0F_LWORD_TO_UDINT\0F_LWORD_TO_UINT\0F_LWORD_TO_ULINT\0F_LWORD_TO_USINT\0F_LWORD_TO_WORD\0F_LWORD_TO_WSTRING\0F_MAX\0F_MID\0F_MIN\0F_MOD\0F_MOVE\0F_MUL\0F_MULTIME\0F_MUX_2\0F_NE\0F_NOT\0F_OR\0F_REAL_TO_DINT\0F_REAL_TO_DWORD\0F_REAL_TO_INT\0F_REAL_TO_LINT\0F_REAL_TO_LREAL\0F_REAL_TO_SINT\0F_REAL_TO_STRING\0F_REAL_TO_UDINT\0F_REAL_TO_UINT\0F_REAL_TO_ULINT\0F_REAL_TO_USINT\0F_REAL_TO_WSTRING\0F_REPLACE\0F_RIGHT\0F_ROL\0F_ROR\0F_SEL\0F_SHL\0F_SHR\0F_SIN\0F_SINT_TO_BYTE\0F_SINT_TO_DINT\0F_SINT_TO_DWORD\0F_SINT_TO_INT\0F_SINT_TO_LINT\0F_SINT_TO_LREAL\0F_SINT_TO_LWORD\0F_SINT_TO_REAL\0F_SINT_TO_STRING\0F_SINT_TO_UDINT\0F_SINT_TO_UINT\0F_SINT_TO_ULINT\0F_SINT_TO_USINT\0F_SINT_TO_WORD\0F_SINT_TO_WSTRING\0F_SQRT\0F_STRING_TO_BOOL\0F_STRING_TO_BYTE\0F_STRING_TO_DINT\0F_STRING_TO_DWORD\0F_STRING_TO_INT\0F_STRING_TO_LINT\0F_STRING_TO_LREAL\0F_STRING_TO_LWORD\0F_STRING_TO_REAL\0F_STRING_TO_SINT\0F_STRING_TO_TIME\0F_STRING_TO_UDINT\0F_STRING_TO_UINT\0F_STRING_TO_ULINT\0F_STRING_TO_USINT\0F_STRING_TO_WORD\0F_STRING_TO_WSTRING\0F_SUB\0F_SUB_DATE_DATE\0F_SUB_DT_DT\0F_SUB_DT_TIME\0F_SUB_TOD_TIME\0F_SUB_TOD_TOD\0F_TAN\0F_TIME_IN_MS_TO_LINT\0F_TIME_IN_MS_TO_LREAL\0F_TIME_IN_MS_TO_ULINT\0F_TIME_IN_NS_TO_LINT\0F_TIME_IN_NS_TO_LREAL\0F_TIME_IN_NS_TO_ULINT\0F_TIME_IN_S_TO_LINT\0F_TIME_IN_S_TO_LREAL\0F_TIME_IN_S_TO_ULINT\0F_TIME_IN_US_TO_LINT\0F_TIME_IN_US_TO_LREAL\0F_TIME_IN_US_TO_ULINT\0F_TIME_TO_STRING\0F_TIME_TO_WSTRING\0F_TRUNC\0F_UDINT_TO_BCD_DWORD\0F_UDINT_TO_BYTE\0F_UDINT_TO_DINT\0F_UDINT_TO_DWORD\0F_UDINT_TO_INT\0F_UDINT_TO_LINT\0F_UDINT_TO_LREAL\0F_UDINT_TO_LWORD\0F_UDINT_TO_REAL\0F_UDINT_TO_SINT\0F_UDINT_TO_STRING\0F_UDINT_TO_UINT\0F_UDINT_TO_ULINT\0F_UDINT_TO_WORD\0F_UDINT_TO_WSTRING\0F_UINT_TO_BCD_WORD\0F_UINT_TO_BYTE\0F_UINT_TO_DINT\0F_UINT_TO_DWORD\0F_UINT_TO_INT\0F_UINT_TO_LINT\0F_UINT_TO_LREAL\0F_UINT_TO_LWORD\0F_UINT_TO_REAL\0F_UINT_TO_SINT\0F_UINT_TO_STRING\0F_UINT_TO_UDINT\0F_UINT_TO_ULINT\0F_UINT_TO_USINT\0F_UINT_TO_WORD\0F_UINT_TO_WSTRING\0F_ULINT_TO_BCD_LWORD\0F_ULINT_TO_BYTE\0F_ULINT_TO_DINT\0F_ULINT_TO_DWORD\0F_ULINT_TO_INT\0F_ULINT_TO_LINT\0F_ULINT_TO_LREAL\0F_ULINT_TO_LWORD\0F_ULINT_TO_REAL\0F_ULINT_TO_SINT\0F_ULINT_TO_STRING\0F_ULINT_TO_UDINT\0F_ULINT_TO_UINT\0F_ULINT_TO_USINT\0F_ULINT_TO_WORD\0F_ULINT_TO_WSTRING\0F_USINT_TO_BCD_BYTE\0F_USINT_TO_BYTE\0F_USINT_TO_DINT\0F_USINT_TO_DWORD\0F_USINT_TO_INT\0F_USINT_TO_LINT\0F_USINT_TO_LREAL\0F_USINT_TO_LWORD\0F_USINT_TO_REAL\0F_USINT_TO_SINT\0F_USINT_TO_STRING\0F_USINT_TO_UDINT\0F_USINT_TO_UINT\0F_USINT_TO_ULINT\0F_USINT_TO_WORD\0F_USINT_TO_WSTRING\0F_WORD_BCD_TO_UINT\0F_WORD_TO_BYTE\0F_WORD_TO_DINT\0F_WORD_TO_DWORD\0F_WORD_TO_INT\0F_WORD_TO_LINT\0F_WORD_TO_LWORD\0F_WORD_TO_SINT\0F_WORD_TO_STRING\0F_WORD_TO_UDINT\0F_WORD_TO_UINT\0F_WORD_TO_ULINT\0F_WORD_TO_USINT\0F_WORD_TO_WSTRING\0F_WSTRING_TO_BOOL\0F_WSTRING_TO_BYTE\0F_WSTRING_TO_DINT\0F_WSTRING_TO_DWORD\0F_WSTRING_TO_INT\0F_WSTRING_TO_LINT\0F_WSTRING_TO_LREAL\0F_WSTRING_TO_LWORD\0F_WSTRING_TO_REAL\0F_WSTRING_TO_SINT\0F_WSTRING_TO_STRING\0F_WSTRING_TO_TIME\0F_WSTRING_TO_UDINT\0F_WSTRING_TO_UINT\0F_WSTRING_TO_ULINT\0F_WSTRING_TO_USINT\0F_WSTRING_TO_WORD\0F_XOR\0G\0GATE\0GEN_ADD\0GEN_AND\0GEN_APPEND_STRING\0GEN_ARRAY2ARRAY\0GEN_ARRAY2VALUES\0GEN_CLIENT\0GEN_CSV_WRITER\0GEN_E_DEMUX\0GEN_E_MUX\0GEN_F_MUX\0GEN_OR\0GEN_PUBL\0GEN_PUBLISH\0GEN_SERVER\0GEN_STRUCT_DEMUX\0GEN_STRUCT_MUX\0GEN_SUBL\0GEN_SUBSCRIBE\0GEN_VALUES2ARRAY\0GEN_XOR\0GET_AT_INDEX\0GET_STRUCT_VALUE\0GET_STRUCT_VALUE_Struct_test1\0GET_STRUCT_VALUE_Struct_test2\0ID\0IN\0IN0\0IN1\0IN2\0IND\0INDEX\0INIT\0INITO\0INNER\0INT\0INT2INT\0IN_ARRAY\0InstanceName\0K\0L\0LABEL\0LD\0LDO\0LINT\0LOWERCASETEST\0LREAL\0LREAL2LREAL\0LWORD\0MGR\0MGR_FF\0MGR_ID\0MN\0MX\0N\0OUT\0OUTER\0OUT_ANY_CONSOLE\0OUT_ARRAY\0P\0PERMIT\0PERMIT_OP\0PT\0PV\0Q\0Q1\0QD\0QI\0QO\0QU\0R\0R1\0REAL\0REAL2REAL\0REQ\0RESET\0RESET_CHANGED\0RESP\0RMT_RES\0RO\0RQST\0RSP\0S\0S1\0SEED\0SET\0SET_AT_INDEX\0SET_CHANGED\0SINT\0SINT2SINT\0SR\0START\0STATUS\0STEST_END\0STOP\0STRING\0STRING2STRING\0STRUCT_DEMUX_1REAL\0STRUCT_DEMUX_1STRING\0STRUCT_DEMUX_1Struct_Muxer_Test_Struct_1\0STRUCT_DEMUX_1Struct_Muxer_Test_Struct_2\0STRUCT_DEMUX_1Struct_Muxer_Test_Struct_3\0STRUCT_DEMUX_1Struct_Muxer_Test_Struct_4\0STRUCT_DEMUX_1UnknownType\0STRUCT_MUX_1REAL\0STRUCT_MUX_1STRING\0STRUCT_MUX_1Struct_Muxer_Test_Struct_1\0STRUCT_MUX_1Struct_Muxer_Test_Struct_2\0STRUCT_MUX_1Struct_Muxer_Test_Struct_3\0STRUCT_MUX_1Struct_Muxer_Test_Struct_4\0STRUCT_MUX_1UnknownType\0Struct_Muxer_Test_Struct_1\0Struct_Muxer_Test_Struct_2\0Struct_Muxer_Test_Struct_3\0Struct_Muxer_Test_Struct_4\0TD\0TEST_CONDITION\0TIME\0TIME2TIME\0TIME_OF_DAY\0TestStruct1\0TestStruct2\0TestStruct3\0TestStruct4\0TimeOut\0TimeOutSocket\0UDINT\0UDINT2UDINT\0UINT\0UINT2UINT\0ULINT\0UNDEFINEDDATATYPE\0USINT\0USINT2USINT\0VAL\0VALUE\0Val1\0Val2\0Val3\0Val4\0Var0\0Var1\0Var10\0Var100\0Var101\0Var102\0Var103\0Var104\0Var105\0Var106\0Var107\0Var108\0Var109\0Var11\0Var110\0Var111\0Var112\0Var113\0Var114\0Var115\0Var116\0Var117\0Var118\0Var119\0Var12\0Var120\0Var121\0Var122\0Var123\0Var124\0Var125\0Var126\0Var127\0Var128\0Var129\0Var13\0Var130\0Var131\0Var132\0Var133\0Var134\0Var135\0Var136\0Var137\0Var138\0Var139\0Var14\0Var140\0Var141\0Var142\0Var143\0Var144\0Var145\0Var146\0Var147\0Var148\0Var149\0Var15\0Var150\0Var151\0Var152\0Var153\0Var154\0Var155\0Var156\0Var157\0Var158\0Var159\0Var16\0Var160\0Var161\0Var162\0Var163\0Var164\0Var165\0Var166\0Var167\0Var168\0Var169\0Var17\0Var170\0Var171\0Var172\0Var173\0Var174\0Var175\0Var176\0Var177\0Var178\0Var179\0Var18\0Var180\0Var181\0Var182\0Var183\0Var184\0Var185\0Var186\0Var187\0Var188\0Var189\0Var19\0Var190\0Var191\0Var192\0Var193\0Var194\0Var195\0Var196\0Var197\0Var198\0Var199\0Var2\0Var20\0Var200\0Var201\0Var202\0Var203\0Var204\0Var205\0Var206\0Var207\0Var208\0Var209\0Var21\0Var210\0Var211\0Var212\0Var213\0Var214\0Var215\0Var216\0Var217\0Var218\0Var219\0Var22\0Var220\0Var221\0Var222\0Var223\0Var224\0Var225\0Var226\0Var227\0Var228\0Var229\0Var23\0Var230\0Var231\0Var232\0Var233\0Var234\0Var235\0Var236\0Var237\0Var238\0Var239\0Var24\0Var240\0Var241\0Var242\0Var243\0Var244\0Var245\0Var246\0Var247\0Var248\0Var249\0Var25\0Var250\0Var251\0Var252\0Var253\0Var254\0Var26\0Var27\0Var28\0Var29\0Var3\0Var30\0Var31\0Var32\0Var33\0Var34\0Var35\0Var36\0Var37\0Var38\0Var39\0Var4\0Var40\0Var41\0Var42\0Var43\0Var44\0Var45\0Var46\0Var47\0Var48\0Var49\0Var5\0Var50\0Var51\0Var52\0Var53\0Var54\0Var55\0Var56\0Var57\0Var58\0Var59\0Var6\0Var60\0Var61\0Var62\0Var63\0Var64\0Var65\0Var66\0Var67\0Var68\0Var69\0Var7\0Var70\0Var71\0Var72\0Var73\0Var74\0Var75\0Var76\0Var77\0Var78\0Var79\0Var8\0Var80\0Var81\0Var82\0Var83\0Var84\0Var85\0Var86\0Var87\0Var88\0Var89\0Var9\0Var90\0Var91\0Var92\0Var93\0Var94\0Var95\0Var96\0Var97\0Var98\0Var99\0WARM\0WORD\0WORD2WORD\0WSTRING\0WSTRING2WSTRING\0check\0in_struct\0lowercasetest\0member\0output\0startTime\0wARM\0"};
+
+ 
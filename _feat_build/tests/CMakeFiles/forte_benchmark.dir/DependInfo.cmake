@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/arch/asyncloggerbenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/arch/asyncloggerbenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/arch/asyncloggerbenchmark.cpp.o.d"
+  "/root/repo/tests/arch/poolallocbenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/arch/poolallocbenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/arch/poolallocbenchmark.cpp.o.d"
+  "/root/repo/tests/arch/timingwheelbenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/arch/timingwheelbenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/arch/timingwheelbenchmark.cpp.o.d"
+  "/root/repo/tests/arch/udpbatchbenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/arch/udpbatchbenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/arch/udpbatchbenchmark.cpp.o.d"
+  "/root/repo/tests/core/cominfra/fbdkasn1layerbenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/core/cominfra/fbdkasn1layerbenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/core/cominfra/fbdkasn1layerbenchmark.cpp.o.d"
+  "/root/repo/tests/core/fbcontainerbenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/core/fbcontainerbenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/core/fbcontainerbenchmark.cpp.o.d"
+  "/root/repo/tests/core/fbportindexbenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/core/fbportindexbenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/core/fbportindexbenchmark.cpp.o.d"
+  "/root/repo/tests/core/fbtests/fbtesterglobalfixture.cpp" "tests/CMakeFiles/forte_benchmark.dir/core/fbtests/fbtesterglobalfixture.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/core/fbtests/fbtesterglobalfixture.cpp.o.d"
+  "/root/repo/tests/core/monitoringbenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/core/monitoringbenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/core/monitoringbenchmark.cpp.o.d"
+  "/root/repo/tests/core/typelibbenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/core/typelibbenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/core/typelibbenchmark.cpp.o.d"
+  "/root/repo/tests/core/utils/mpscqueuebenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/core/utils/mpscqueuebenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/core/utils/mpscqueuebenchmark.cpp.o.d"
+  "/root/repo/tests/core/utils/seqlockbenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/core/utils/seqlockbenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/core/utils/seqlockbenchmark.cpp.o.d"
+  "/root/repo/tests/forte_boost_tester.cpp" "tests/CMakeFiles/forte_benchmark.dir/forte_boost_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/forte_boost_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/ita/bootfilebenchmark.cpp" "tests/CMakeFiles/forte_benchmark.dir/stdfblib/ita/bootfilebenchmark.cpp.o" "gcc" "tests/CMakeFiles/forte_benchmark.dir/stdfblib/ita/bootfilebenchmark.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/forte_benchmark.dir/arch/asyncloggerbenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/arch/asyncloggerbenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/arch/poolallocbenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/arch/poolallocbenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/arch/timingwheelbenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/arch/timingwheelbenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/arch/udpbatchbenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/arch/udpbatchbenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/core/cominfra/fbdkasn1layerbenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/core/cominfra/fbdkasn1layerbenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/core/fbcontainerbenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/core/fbcontainerbenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/core/fbportindexbenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/core/fbportindexbenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/core/fbtests/fbtesterglobalfixture.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/core/fbtests/fbtesterglobalfixture.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/core/monitoringbenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/core/monitoringbenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/core/typelibbenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/core/typelibbenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/core/utils/mpscqueuebenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/core/utils/mpscqueuebenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/core/utils/seqlockbenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/core/utils/seqlockbenchmark.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/forte_boost_tester.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/forte_boost_tester.cpp.o.d"
+  "CMakeFiles/forte_benchmark.dir/stdfblib/ita/bootfilebenchmark.cpp.o"
+  "CMakeFiles/forte_benchmark.dir/stdfblib/ita/bootfilebenchmark.cpp.o.d"
+  "forte_benchmark"
+  "forte_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/forte_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_feat_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(forte_test "/forte_test")
+set_tests_properties(forte_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;148;add_test;/root/repo/tests/CMakeLists.txt;0;")
+subdirs("arch")
+subdirs("core")
+subdirs("modules")
+subdirs("stdfblib")
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/arch
+# Build directory: /root/repo/_feat_build/tests/arch
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("utils")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/core/datatypes/CIEC_PARTIAL
+# Build directory: /root/repo/_feat_build/tests/core/datatypes/CIEC_PARTIAL
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/core/datatypes
+# Build directory: /root/repo/_feat_build/tests/core/datatypes
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("CIEC_PARTIAL")
+subdirs("convert")
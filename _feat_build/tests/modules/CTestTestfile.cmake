@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/modules
+# Build directory: /root/repo/_feat_build/tests/modules
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("convert")
+subdirs("IEC61131-3")
+subdirs("utils")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/modules/IEC61131-3
+# Build directory: /root/repo/_feat_build/tests/modules/IEC61131-3
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
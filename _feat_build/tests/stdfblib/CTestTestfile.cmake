@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/stdfblib
+# Build directory: /root/repo/_feat_build/tests/stdfblib
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("events")
+subdirs("ita")
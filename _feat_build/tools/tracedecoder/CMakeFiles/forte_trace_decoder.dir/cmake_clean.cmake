@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/forte_trace_decoder.dir/forte_trace_decoder.cpp.o"
+  "CMakeFiles/forte_trace_decoder.dir/forte_trace_decoder.cpp.o.d"
+  "forte_trace_decoder"
+  "forte_trace_decoder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/forte_trace_decoder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,263 @@
+file(REMOVE_RECURSE
+  "libforte_stringlist_externals.a"
+  "libforte_stringlist_externals.pdb"
+  "src_gen/ARTimeOut_gen.cpp"
+  "src_gen/ATimeOut_gen.cpp"
+  "src_gen/BOOL2BOOL_gen.cpp"
+  "src_gen/BYTE2BYTE_gen.cpp"
+  "src_gen/CFB_TEST_gen.cpp"
+  "src_gen/CFB_TEST_tester_gen.cpp"
+  "src_gen/CIEC_ANY_tests_gen.cpp"
+  "src_gen/CIEC_ARRAY_test_gen.cpp"
+  "src_gen/CIEC_BOOL_CASTS_test_gen.cpp"
+  "src_gen/CIEC_BOOL_test_gen.cpp"
+  "src_gen/CIEC_BYTE_CASTS_test_gen.cpp"
+  "src_gen/CIEC_BYTE_PARTIAL_test_gen.cpp"
+  "src_gen/CIEC_BYTE_test_gen.cpp"
+  "src_gen/CIEC_DATE_AND_TIME_test_gen.cpp"
+  "src_gen/CIEC_DATE_test_gen.cpp"
+  "src_gen/CIEC_DINT_CASTS_test_gen.cpp"
+  "src_gen/CIEC_DINT_test_gen.cpp"
+  "src_gen/CIEC_DWORD_CASTS_test_gen.cpp"
+  "src_gen/CIEC_DWORD_PARTIAL_test_gen.cpp"
+  "src_gen/CIEC_DWORD_test_gen.cpp"
+  "src_gen/CIEC_INT_CASTS_test_gen.cpp"
+  "src_gen/CIEC_INT_test_gen.cpp"
+  "src_gen/CIEC_LINT_CASTS_test_gen.cpp"
+  "src_gen/CIEC_LINT_test_gen.cpp"
+  "src_gen/CIEC_LREAL_CASTS_test_gen.cpp"
+  "src_gen/CIEC_LREAL_test_gen.cpp"
+  "src_gen/CIEC_LWORD_CASTS_test_gen.cpp"
+  "src_gen/CIEC_LWORD_PARTIAL_test_gen.cpp"
+  "src_gen/CIEC_LWORD_test_gen.cpp"
+  "src_gen/CIEC_REAL_CASTS_test_gen.cpp"
+  "src_gen/CIEC_REAL_test_gen.cpp"
+  "src_gen/CIEC_SINT_CASTS_test_gen.cpp"
+  "src_gen/CIEC_SINT_test_gen.cpp"
+  "src_gen/CIEC_STRING_test_gen.cpp"
+  "src_gen/CIEC_STRUCT_test_gen.cpp"
+  "src_gen/CIEC_TIME_OF_DAY_test_gen.cpp"
+  "src_gen/CIEC_TIME_test_gen.cpp"
+  "src_gen/CIEC_UDINT_CASTS_test_gen.cpp"
+  "src_gen/CIEC_UDINT_test_gen.cpp"
+  "src_gen/CIEC_UINT_CASTS_test_gen.cpp"
+  "src_gen/CIEC_UINT_test_gen.cpp"
+  "src_gen/CIEC_ULINT_CASTS_test_gen.cpp"
+  "src_gen/CIEC_ULINT_test_gen.cpp"
+  "src_gen/CIEC_USINT_CASTS_test_gen.cpp"
+  "src_gen/CIEC_USINT_test_gen.cpp"
+  "src_gen/CIEC_WORD_CASTS_test_gen.cpp"
+  "src_gen/CIEC_WORD_PARTIAL_test_gen.cpp"
+  "src_gen/CIEC_WORD_test_gen.cpp"
+  "src_gen/CIEC_WSTRING_test_gen.cpp"
+  "src_gen/CUnicodeUtilities_test_gen.cpp"
+  "src_gen/DEV_MGR_gen.cpp"
+  "src_gen/DINT2DINT_gen.cpp"
+  "src_gen/DWORD2DWORD_gen.cpp"
+  "src_gen/EMB_RES_gen.cpp"
+  "src_gen/E_CTD_gen.cpp"
+  "src_gen/E_CTD_tester_gen.cpp"
+  "src_gen/E_CTUD_gen.cpp"
+  "src_gen/E_CTUD_tester_gen.cpp"
+  "src_gen/E_CTU_gen.cpp"
+  "src_gen/E_CTU_tester_gen.cpp"
+  "src_gen/E_CYCLE_gen.cpp"
+  "src_gen/E_DELAY_gen.cpp"
+  "src_gen/E_DEMUX_gen.cpp"
+  "src_gen/E_D_FF_gen.cpp"
+  "src_gen/E_F_TRIG_gen.cpp"
+  "src_gen/E_F_TRIG_tester_gen.cpp"
+  "src_gen/E_MERGE_gen.cpp"
+  "src_gen/E_PERMIT_gen.cpp"
+  "src_gen/E_PERMIT_tester_gen.cpp"
+  "src_gen/E_RDELAY_gen.cpp"
+  "src_gen/E_REND_gen.cpp"
+  "src_gen/E_RESTART_gen.cpp"
+  "src_gen/E_RS_gen.cpp"
+  "src_gen/E_RTimeOut_gen.cpp"
+  "src_gen/E_R_TRIG_gen.cpp"
+  "src_gen/E_R_TRIG_tester_gen.cpp"
+  "src_gen/E_SELECT_gen.cpp"
+  "src_gen/E_SELECT_tester_gen.cpp"
+  "src_gen/E_SPLIT_gen.cpp"
+  "src_gen/E_SR_gen.cpp"
+  "src_gen/E_SR_tester_gen.cpp"
+  "src_gen/E_STOPWATCH_gen.cpp"
+  "src_gen/E_SWITCH_gen.cpp"
+  "src_gen/E_SWITCH_tester_gen.cpp"
+  "src_gen/E_TRAIN_gen.cpp"
+  "src_gen/E_T_FF_gen.cpp"
+  "src_gen/E_TimeOut_gen.cpp"
+  "src_gen/FB_RANDOM_gen.cpp"
+  "src_gen/ForteBinaryBootFile_gen.cpp"
+  "src_gen/ForteBootFileLoader_gen.cpp"
+  "src_gen/GEN_APPEND_STRING_gen.cpp"
+  "src_gen/GEN_ARRAY2ARRAY_gen.cpp"
+  "src_gen/GEN_ARRAY2VALUES_gen.cpp"
+  "src_gen/GEN_CLIENT_gen.cpp"
+  "src_gen/GEN_CSV_WRITER_gen.cpp"
+  "src_gen/GEN_E_DEMUX_gen.cpp"
+  "src_gen/GEN_E_MUX_gen.cpp"
+  "src_gen/GEN_F_MUX_gen.cpp"
+  "src_gen/GEN_PUBLISH_gen.cpp"
+  "src_gen/GEN_PUBL_gen.cpp"
+  "src_gen/GEN_SERVER_gen.cpp"
+  "src_gen/GEN_STRUCT_DEMUX_gen.cpp"
+  "src_gen/GEN_STRUCT_DEMUX_tester_gen.cpp"
+  "src_gen/GEN_STRUCT_MUX_gen.cpp"
+  "src_gen/GEN_STRUCT_MUX_tester_gen.cpp"
+  "src_gen/GEN_SUBL_gen.cpp"
+  "src_gen/GEN_SUBSCRIBE_gen.cpp"
+  "src_gen/GEN_VALUES2ARRAY_gen.cpp"
+  "src_gen/GET_AT_INDEX_gen.cpp"
+  "src_gen/GET_STRUCT_VALUE_gen.cpp"
+  "src_gen/GET_STRUCT_VALUE_tester_gen.cpp"
+  "src_gen/INT2INT_gen.cpp"
+  "src_gen/LREAL2LREAL_gen.cpp"
+  "src_gen/OUT_ANY_CONSOLE_gen.cpp"
+  "src_gen/REAL2REAL_gen.cpp"
+  "src_gen/RMT_DEV_gen.cpp"
+  "src_gen/RMT_RES_gen.cpp"
+  "src_gen/SET_AT_INDEX_gen.cpp"
+  "src_gen/SINT2SINT_gen.cpp"
+  "src_gen/STEST_END_gen.cpp"
+  "src_gen/STRING2STRING_gen.cpp"
+  "src_gen/TEST_CONDITION_gen.cpp"
+  "src_gen/TIME2TIME_gen.cpp"
+  "src_gen/UDINT2UDINT_gen.cpp"
+  "src_gen/UINT2UINT_gen.cpp"
+  "src_gen/USINT2USINT_gen.cpp"
+  "src_gen/WORD2WORD_gen.cpp"
+  "src_gen/WSTRING2WSTRING_gen.cpp"
+  "src_gen/adapter_gen.cpp"
+  "src_gen/adapterconn_gen.cpp"
+  "src_gen/alloccheckTest_gen.cpp"
+  "src_gen/alloccheck_gen.cpp"
+  "src_gen/anyadapter_gen.cpp"
+  "src_gen/anytostringtests_gen.cpp"
+  "src_gen/asynclogger_gen.cpp"
+  "src_gen/basecommfb_gen.cpp"
+  "src_gen/basicfb_gen.cpp"
+  "src_gen/binarybootfiletests_gen.cpp"
+  "src_gen/bsdsocketinterf_gen.cpp"
+  "src_gen/cfb_gen.cpp"
+  "src_gen/comlayer_gen.cpp"
+  "src_gen/comlayersmanager_gen.cpp"
+  "src_gen/commfb_gen.cpp"
+  "src_gen/configFileParser_gen.cpp"
+  "src_gen/conn_gen.cpp"
+  "src_gen/convert_functionstests_gen.cpp"
+  "src_gen/convert_to_STRING_test_gen.cpp"
+  "src_gen/convert_to_WSTRING_test_gen.cpp"
+  "src_gen/dataconn_gen.cpp"
+  "src_gen/devexec_gen.cpp"
+  "src_gen/deviceExecutionHandlers_gen.cpp"
+  "src_gen/device_gen.cpp"
+  "src_gen/devlog_gen.cpp"
+  "src_gen/devmgrsubscriptiontests_gen.cpp"
+  "src_gen/ecetFactory_gen.cpp"
+  "src_gen/ecet_gen.cpp"
+  "src_gen/eventconn_gen.cpp"
+  "src_gen/extevhan_gen.cpp"
+  "src_gen/extractLayerAndParamsTest_gen.cpp"
+  "src_gen/fbcontainer_gen.cpp"
+  "src_gen/fbcontainertests_gen.cpp"
+  "src_gen/fbdkasn1layer_gen.cpp"
+  "src_gen/fbdkasn1layerdeser_test_gen.cpp"
+  "src_gen/fbdkasn1layerser_test_gen.cpp"
+  "src_gen/fbportindex_gen.cpp"
+  "src_gen/fbportindextests_gen.cpp"
+  "src_gen/fbtesterglobalfixture_gen.cpp"
+  "src_gen/fbtestfixture_gen.cpp"
+  "src_gen/fdselecthand_gen.cpp"
+  "src_gen/forte_any_bit_gen.cpp"
+  "src_gen/forte_any_date_gen.cpp"
+  "src_gen/forte_any_elementary_gen.cpp"
+  "src_gen/forte_any_gen.cpp"
+  "src_gen/forte_any_int_gen.cpp"
+  "src_gen/forte_any_magnitude_gen.cpp"
+  "src_gen/forte_any_num_gen.cpp"
+  "src_gen/forte_any_real_gen.cpp"
+  "src_gen/forte_any_string_gen.cpp"
+  "src_gen/forte_architecture_time_gen.cpp"
+  "src_gen/forte_array_gen.cpp"
+  "src_gen/forte_bool_gen.cpp"
+  "src_gen/forte_boost_tester_gen.cpp"
+  "src_gen/forte_byte_gen.cpp"
+  "src_gen/forte_byteswap_gen.cpp"
+  "src_gen/forte_byteswaptest_gen.cpp"
+  "src_gen/forte_date_and_time_gen.cpp"
+  "src_gen/forte_date_gen.cpp"
+  "src_gen/forte_dint_gen.cpp"
+  "src_gen/forte_dword_gen.cpp"
+  "src_gen/forte_int_gen.cpp"
+  "src_gen/forte_lint_gen.cpp"
+  "src_gen/forte_lreal_gen.cpp"
+  "src_gen/forte_lword_gen.cpp"
+  "src_gen/forte_real_gen.cpp"
+  "src_gen/forte_sem_gen.cpp"
+  "src_gen/forte_sint_gen.cpp"
+  "src_gen/forte_string_gen.cpp"
+  "src_gen/forte_struct_gen.cpp"
+  "src_gen/forte_sync_gen.cpp"
+  "src_gen/forte_thread_gen.cpp"
+  "src_gen/forte_time_gen.cpp"
+  "src_gen/forte_time_of_day_gen.cpp"
+  "src_gen/forte_udint_gen.cpp"
+  "src_gen/forte_uint_gen.cpp"
+  "src_gen/forte_ulint_gen.cpp"
+  "src_gen/forte_usint_gen.cpp"
+  "src_gen/forte_word_gen.cpp"
+  "src_gen/forte_wstring_gen.cpp"
+  "src_gen/funcbloc_gen.cpp"
+  "src_gen/genforte_printer_gen.cpp"
+  "src_gen/genforte_realFunctions_gen.cpp"
+  "src_gen/iec61131_functions_gen.cpp"
+  "src_gen/iec61131_functionstests_gen.cpp"
+  "src_gen/if2indco_gen.cpp"
+  "src_gen/internalvartests_gen.cpp"
+  "src_gen/ipcomlayer_gen.cpp"
+  "src_gen/ipcomlayertest_gen.cpp"
+  "src_gen/localcomlayer_gen.cpp"
+  "src_gen/mainparam_utils_gen.cpp"
+  "src_gen/mgmstatemachinetest_gen.cpp"
+  "src_gen/monitoring_gen.cpp"
+  "src_gen/monitoringtests_gen.cpp"
+  "src_gen/mpmcqueuetest_gen.cpp"
+  "src_gen/mpscqueuetest_gen.cpp"
+  "src_gen/nameidentifiertest_gen.cpp"
+  "src_gen/parameterParserTest_gen.cpp"
+  "src_gen/parameterParser_gen.cpp"
+  "src_gen/pctimeha_gen.cpp"
+  "src_gen/poolalloc_gen.cpp"
+  "src_gen/poolalloctest_gen.cpp"
+  "src_gen/rawdatacomlayer_gen.cpp"
+  "src_gen/resource_gen.cpp"
+  "src_gen/seqlocktest_gen.cpp"
+  "src_gen/simplefb_gen.cpp"
+  "src_gen/singeltontest_gen.cpp"
+  "src_gen/singletontest2ndunit_gen.cpp"
+  "src_gen/spscbyteringtest_gen.cpp"
+  "src_gen/string_utils_gen.cpp"
+  "src_gen/string_utils_test_gen.cpp"
+  "src_gen/stringdict_gen.cpp"
+  "src_gen/stringdicttests_gen.cpp"
+  "src_gen/struct_mux_demux_data_gen.cpp"
+  "src_gen/testsingleton_gen.cpp"
+  "src_gen/timedfb_gen.cpp"
+  "src_gen/timerha_gen.cpp"
+  "src_gen/timespec_utils_gen.cpp"
+  "src_gen/timespec_utils_tests_gen.cpp"
+  "src_gen/timingwheel_gen.cpp"
+  "src_gen/timingwheeltest_gen.cpp"
+  "src_gen/typelib_gen.cpp"
+  "src_gen/typelibdatatypetests_gen.cpp"
+  "src_gen/typelibtests_gen.cpp"
+  "src_gen/udpsendbatch_gen.cpp"
+  "src_gen/unicode_utils_gen.cpp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/forte_stringlist_externals.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
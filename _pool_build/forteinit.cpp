@@ -0,0 +1,227 @@
+/*******************************************************************************
+ * Copyright (c) 2011, 2014 Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Gerhard Ebenhofer, Matthias Plasch
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+
+
+#include "forteinit.h"
+
+#include </root/repo/src/core/datatypes/forte_any.h>
+
+#include </root/repo/src/core/datatypes/forte_any_bit.h>
+#include </root/repo/src/core/datatypes/forte_any_elementary.h>
+#include </root/repo/src/core/datatypes/forte_any_int.h>
+#include </root/repo/src/core/datatypes/forte_any_magnitude.h>
+#include </root/repo/src/core/datatypes/forte_any_num.h>
+#include </root/repo/src/core/datatypes/forte_any_real.h>
+#include </root/repo/src/core/datatypes/forte_any_string.h>
+#include </root/repo/src/core/datatypes/forte_array.h>
+#include </root/repo/src/core/datatypes/forte_bool.h>
+#include </root/repo/src/core/datatypes/forte_byte.h>
+#include </root/repo/src/core/datatypes/forte_date.h>
+#include </root/repo/src/core/datatypes/forte_date_and_time.h>
+#include </root/repo/src/core/datatypes/forte_dint.h>
+#include </root/repo/src/core/datatypes/forte_dword.h>
+#include </root/repo/src/core/datatypes/forte_int.h>
+#include </root/repo/src/core/datatypes/forte_lint.h>
+#include </root/repo/src/core/datatypes/forte_lreal.h>
+#include </root/repo/src/core/datatypes/forte_lword.h>
+#include </root/repo/src/core/datatypes/forte_real.h>
+#include </root/repo/src/core/datatypes/forte_sint.h>
+#include </root/repo/src/core/datatypes/forte_string.h>
+#include </root/repo/src/core/datatypes/forte_time.h>
+#include </root/repo/src/core/datatypes/forte_time_of_day.h>
+#include </root/repo/src/core/datatypes/forte_udint.h>
+#include </root/repo/src/core/datatypes/forte_uint.h>
+#include </root/repo/src/core/datatypes/forte_ulint.h>
+#include </root/repo/src/core/datatypes/forte_usint.h>
+#include </root/repo/src/core/datatypes/forte_word.h>
+#include </root/repo/src/core/datatypes/forte_wstring.h>
+
+
+#include </root/repo/src/modules/convert/BOOL2BOOL.h>
+#include </root/repo/src/modules/convert/BYTE2BYTE.h>
+#include </root/repo/src/modules/convert/DINT2DINT.h>
+#include </root/repo/src/modules/convert/DWORD2DWORD.h>
+#include </root/repo/src/modules/convert/GEN_STRUCT_DEMUX.h>
+#include </root/repo/src/modules/convert/GEN_STRUCT_MUX.h>
+#include </root/repo/src/modules/convert/INT2INT.h>
+#include </root/repo/src/modules/convert/LREAL2LREAL.h>
+#include </root/repo/src/modules/convert/REAL2REAL.h>
+#include </root/repo/src/modules/convert/SINT2SINT.h>
+#include </root/repo/src/modules/convert/STRING2STRING.h>
+#include </root/repo/src/modules/convert/TIME2TIME.h>
+#include </root/repo/src/modules/convert/UDINT2UDINT.h>
+#include </root/repo/src/modules/convert/UINT2UINT.h>
+#include </root/repo/src/modules/convert/USINT2USINT.h>
+#include </root/repo/src/modules/convert/WORD2WORD.h>
+#include </root/repo/src/modules/convert/WSTRING2WSTRING.h>
+#include </root/repo/src/modules/utils/E_STOPWATCH.h>
+#include </root/repo/src/modules/utils/FB_RANDOM.h>
+#include </root/repo/src/modules/utils/GEN_APPEND_STRING.h>
+#include </root/repo/src/modules/utils/GEN_ARRAY2ARRAY.h>
+#include </root/repo/src/modules/utils/GEN_ARRAY2VALUES.h>
+#include </root/repo/src/modules/utils/GEN_CSV_WRITER.h>
+#include </root/repo/src/modules/utils/GEN_F_MUX.h>
+#include </root/repo/src/modules/utils/GEN_VALUES2ARRAY.h>
+#include </root/repo/src/modules/utils/GET_AT_INDEX.h>
+#include </root/repo/src/modules/utils/GET_STRUCT_VALUE.h>
+#include </root/repo/src/modules/utils/OUT_ANY_CONSOLE.h>
+#include </root/repo/src/modules/utils/SET_AT_INDEX.h>
+#include </root/repo/src/modules/utils/STEST_END.h>
+#include </root/repo/src/modules/utils/TEST_CONDITION.h>
+#include </root/repo/src/stdfblib/events/ARTimeOut.h>
+#include </root/repo/src/stdfblib/events/ATimeOut.h>
+#include </root/repo/src/stdfblib/events/E_CTD.h>
+#include </root/repo/src/stdfblib/events/E_CTU.h>
+#include </root/repo/src/stdfblib/events/E_CTUD.h>
+#include </root/repo/src/stdfblib/events/E_CYCLE.h>
+#include </root/repo/src/stdfblib/events/E_DELAY.h>
+#include </root/repo/src/stdfblib/events/E_DEMUX.h>
+#include </root/repo/src/stdfblib/events/E_D_FF.h>
+#include </root/repo/src/stdfblib/events/E_F_TRIG.h>
+#include </root/repo/src/stdfblib/events/E_MERGE.h>
+#include </root/repo/src/stdfblib/events/E_PERMIT.h>
+#include </root/repo/src/stdfblib/events/E_RDELAY.h>
+#include </root/repo/src/stdfblib/events/E_REND.h>
+#include </root/repo/src/stdfblib/events/E_RESTART.h>
+#include </root/repo/src/stdfblib/events/E_RS.h>
+#include </root/repo/src/stdfblib/events/E_RTimeOut.h>
+#include </root/repo/src/stdfblib/events/E_R_TRIG.h>
+#include </root/repo/src/stdfblib/events/E_SELECT.h>
+#include </root/repo/src/stdfblib/events/E_SPLIT.h>
+#include </root/repo/src/stdfblib/events/E_SR.h>
+#include </root/repo/src/stdfblib/events/E_SWITCH.h>
+#include </root/repo/src/stdfblib/events/E_TRAIN.h>
+#include </root/repo/src/stdfblib/events/E_T_FF.h>
+#include </root/repo/src/stdfblib/events/E_TimeOut.h>
+#include </root/repo/src/stdfblib/events/GEN_E_DEMUX.h>
+#include </root/repo/src/stdfblib/events/GEN_E_MUX.h>
+#include </root/repo/src/stdfblib/ita/DEV_MGR.h>
+#include </root/repo/src/stdfblib/ita/EMB_RES.h>
+#include </root/repo/src/stdfblib/ita/RMT_RES.h>
+#include </root/repo/src/stdfblib/net/GEN_CLIENT.h>
+#include </root/repo/src/stdfblib/net/GEN_PUBL.h>
+#include </root/repo/src/stdfblib/net/GEN_PUBLISH.h>
+#include </root/repo/src/stdfblib/net/GEN_SERVER.h>
+#include </root/repo/src/stdfblib/net/GEN_SUBL.h>
+#include </root/repo/src/stdfblib/net/GEN_SUBSCRIBE.h>
+
+
+extern "C"
+void initForte()
+{
+  CIEC_ANY::dummyInit();
+    CIEC_ANY_BIT::dummyInit();
+  CIEC_ANY_ELEMENTARY::dummyInit();
+  CIEC_ANY_INT::dummyInit();
+  CIEC_ANY_MAGNITUDE::dummyInit();
+  CIEC_ANY_NUM::dummyInit();
+  CIEC_ANY_REAL::dummyInit();
+  CIEC_ANY_STRING::dummyInit();
+  CIEC_ARRAY::dummyInit();
+  CIEC_BOOL::dummyInit();
+  CIEC_BYTE::dummyInit();
+  CIEC_DATE::dummyInit();
+  CIEC_DATE_AND_TIME::dummyInit();
+  CIEC_DINT::dummyInit();
+  CIEC_DWORD::dummyInit();
+  CIEC_INT::dummyInit();
+  CIEC_LINT::dummyInit();
+  CIEC_LREAL::dummyInit();
+  CIEC_LWORD::dummyInit();
+  CIEC_REAL::dummyInit();
+  CIEC_SINT::dummyInit();
+  CIEC_STRING::dummyInit();
+  CIEC_TIME::dummyInit();
+  CIEC_TIME_OF_DAY::dummyInit();
+  CIEC_UDINT::dummyInit();
+  CIEC_UINT::dummyInit();
+  CIEC_ULINT::dummyInit();
+  CIEC_USINT::dummyInit();
+  CIEC_WORD::dummyInit();
+  CIEC_WSTRING::dummyInit();
+
+
+    BOOL2BOOL::dummyInit();
+  BYTE2BYTE::dummyInit();
+  DEV_MGR::dummyInit();
+  DINT2DINT::dummyInit();
+  DWORD2DWORD::dummyInit();
+  EMB_RES::dummyInit();
+  E_CTU::dummyInit();
+  E_CYCLE::dummyInit();
+  E_DELAY::dummyInit();
+  E_DEMUX::dummyInit();
+  E_D_FF::dummyInit();
+  E_F_TRIG::dummyInit();
+  E_MERGE::dummyInit();
+  E_PERMIT::dummyInit();
+  E_RDELAY::dummyInit();
+  E_REND::dummyInit();
+  E_RESTART::dummyInit();
+  E_RS::dummyInit();
+  E_R_TRIG::dummyInit();
+  E_SELECT::dummyInit();
+  E_SPLIT::dummyInit();
+  E_SR::dummyInit();
+  E_SWITCH::dummyInit();
+  FORTE_ARTimeOut::dummyInit();
+  FORTE_ATimeOut::dummyInit();
+  FORTE_E_CTD::dummyInit();
+  FORTE_E_CTUD::dummyInit();
+  FORTE_E_RTimeOut::dummyInit();
+  FORTE_E_STOPWATCH::dummyInit();
+  FORTE_E_TRAIN::dummyInit();
+  FORTE_E_T_FF::dummyInit();
+  FORTE_E_TimeOut::dummyInit();
+  FORTE_FB_RANDOM::dummyInit();
+  FORTE_GET_AT_INDEX::dummyInit();
+  FORTE_GET_STRUCT_VALUE::dummyInit();
+  FORTE_OUT_ANY_CONSOLE::dummyInit();
+  FORTE_SET_AT_INDEX::dummyInit();
+  FORTE_STEST_END::dummyInit();
+  FORTE_TEST_CONDITION::dummyInit();
+  GEN_APPEND_STRING::dummyInit();
+  GEN_ARRAY2ARRAY::dummyInit();
+  GEN_ARRAY2VALUES::dummyInit();
+  GEN_CLIENT::dummyInit();
+  GEN_CSV_WRITER::dummyInit();
+  GEN_E_DEMUX::dummyInit();
+  GEN_E_MUX::dummyInit();
+  GEN_F_MUX::dummyInit();
+  GEN_PUBL::dummyInit();
+  GEN_PUBLISH::dummyInit();
+  GEN_SERVER::dummyInit();
+  GEN_STRUCT_DEMUX::dummyInit();
+  GEN_STRUCT_MUX::dummyInit();
+  GEN_SUBL::dummyInit();
+  GEN_SUBSCRIBE::dummyInit();
+  GEN_VALUES2ARRAY::dummyInit();
+  INT2INT::dummyInit();
+  LREAL2LREAL::dummyInit();
+  REAL2REAL::dummyInit();
+  RMT_RES::dummyInit();
+  SINT2SINT::dummyInit();
+  STRING2STRING::dummyInit();
+  TIME2TIME::dummyInit();
+  UDINT2UDINT::dummyInit();
+  UINT2UINT::dummyInit();
+  USINT2USINT::dummyInit();
+  WORD2WORD::dummyInit();
+  WSTRING2WSTRING::dummyInit();
+
+
+}
+
+
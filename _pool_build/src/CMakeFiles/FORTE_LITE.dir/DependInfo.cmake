@@ -0,0 +1,178 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_pool_build/core/cominfra/comlayersmanager.cpp" "src/CMakeFiles/FORTE_LITE.dir/__/core/cominfra/comlayersmanager.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/__/core/cominfra/comlayersmanager.cpp.o.d"
+  "/root/repo/_pool_build/core/deviceExecutionHandlers.cpp" "src/CMakeFiles/FORTE_LITE.dir/__/core/deviceExecutionHandlers.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/__/core/deviceExecutionHandlers.cpp.o.d"
+  "/root/repo/_pool_build/forteinit.cpp" "src/CMakeFiles/FORTE_LITE.dir/__/forteinit.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/__/forteinit.cpp.o.d"
+  "/root/repo/_pool_build/stringlist.cpp" "src/CMakeFiles/FORTE_LITE.dir/__/stringlist.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/__/stringlist.cpp.o.d"
+  "/root/repo/src/arch/asynclogger.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/asynclogger.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/asynclogger.cpp.o.d"
+  "/root/repo/src/arch/bsdsocketinterf.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/bsdsocketinterf.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/bsdsocketinterf.cpp.o.d"
+  "/root/repo/src/arch/devlog.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/devlog.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/devlog.cpp.o.d"
+  "/root/repo/src/arch/fdselecthand.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/fdselecthand.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/fdselecthand.cpp.o.d"
+  "/root/repo/src/arch/genforte_printer.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/genforte_printer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/genforte_printer.cpp.o.d"
+  "/root/repo/src/arch/genforte_realFunctions.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/genforte_realFunctions.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/genforte_realFunctions.cpp.o.d"
+  "/root/repo/src/arch/posix/forte_architecture_time.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_architecture_time.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_architecture_time.cpp.o.d"
+  "/root/repo/src/arch/posix/forte_sem.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sem.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sem.cpp.o.d"
+  "/root/repo/src/arch/posix/forte_sync.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sync.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sync.cpp.o.d"
+  "/root/repo/src/arch/posix/forte_thread.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_thread.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/forte_thread.cpp.o.d"
+  "/root/repo/src/arch/posix/pctimeha.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/pctimeha.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/pctimeha.cpp.o.d"
+  "/root/repo/src/arch/posix/poolalloc.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/poolalloc.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/posix/poolalloc.cpp.o.d"
+  "/root/repo/src/arch/timerha.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/timerha.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/timerha.cpp.o.d"
+  "/root/repo/src/arch/timingwheel.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/timingwheel.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/timingwheel.cpp.o.d"
+  "/root/repo/src/arch/utils/mainparam_utils.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/utils/mainparam_utils.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/utils/mainparam_utils.cpp.o.d"
+  "/root/repo/src/arch/utils/timespec_utils.cpp" "src/CMakeFiles/FORTE_LITE.dir/arch/utils/timespec_utils.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/arch/utils/timespec_utils.cpp.o.d"
+  "/root/repo/src/core/adapter.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/adapter.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/adapter.cpp.o.d"
+  "/root/repo/src/core/adapterconn.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/adapterconn.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/adapterconn.cpp.o.d"
+  "/root/repo/src/core/anyadapter.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/anyadapter.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/anyadapter.cpp.o.d"
+  "/root/repo/src/core/basicfb.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/basicfb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/basicfb.cpp.o.d"
+  "/root/repo/src/core/cfb.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cfb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cfb.cpp.o.d"
+  "/root/repo/src/core/cominfra/basecommfb.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/basecommfb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/basecommfb.cpp.o.d"
+  "/root/repo/src/core/cominfra/comlayer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/comlayer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/comlayer.cpp.o.d"
+  "/root/repo/src/core/cominfra/commfb.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/commfb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/commfb.cpp.o.d"
+  "/root/repo/src/core/cominfra/fbdkasn1layer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/fbdkasn1layer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/fbdkasn1layer.cpp.o.d"
+  "/root/repo/src/core/cominfra/ipcomlayer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/ipcomlayer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/ipcomlayer.cpp.o.d"
+  "/root/repo/src/core/cominfra/localcomlayer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/localcomlayer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/localcomlayer.cpp.o.d"
+  "/root/repo/src/core/cominfra/rawdatacomlayer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/rawdatacomlayer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/rawdatacomlayer.cpp.o.d"
+  "/root/repo/src/core/cominfra/udpsendbatch.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/udpsendbatch.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/cominfra/udpsendbatch.cpp.o.d"
+  "/root/repo/src/core/conn.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/conn.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/conn.cpp.o.d"
+  "/root/repo/src/core/dataconn.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/dataconn.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/dataconn.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_bit.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_bit.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_bit.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_date.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_date.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_date.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_elementary.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_elementary.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_elementary.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_int.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_int.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_int.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_magnitude.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_magnitude.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_magnitude.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_num.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_num.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_num.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_real.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_real.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_real.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_any_string.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_string.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_string.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_array.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_array.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_array.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_bool.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_bool.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_bool.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_byte.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_byte.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_byte.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_date.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_date_and_time.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date_and_time.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date_and_time.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_dint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_dword.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dword.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dword.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_int.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_int.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_int.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_lint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_lreal.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lreal.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lreal.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_lword.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lword.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lword.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_real.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_real.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_real.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_sint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_sint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_sint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_string.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_string.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_string.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_struct.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_struct.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_struct.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_time.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_time_of_day.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time_of_day.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time_of_day.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_udint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_udint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_udint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_uint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_uint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_uint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_ulint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_ulint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_ulint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_usint.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_usint.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_usint.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_word.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_word.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_word.cpp.o.d"
+  "/root/repo/src/core/datatypes/forte_wstring.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_wstring.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_wstring.cpp.o.d"
+  "/root/repo/src/core/datatypes/unicode_utils.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/unicode_utils.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/datatypes/unicode_utils.cpp.o.d"
+  "/root/repo/src/core/devexec.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/devexec.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/devexec.cpp.o.d"
+  "/root/repo/src/core/device.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/device.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/device.cpp.o.d"
+  "/root/repo/src/core/ecet.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/ecet.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/ecet.cpp.o.d"
+  "/root/repo/src/core/ecetFactory.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/ecetFactory.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/ecetFactory.cpp.o.d"
+  "/root/repo/src/core/eventconn.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/eventconn.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/eventconn.cpp.o.d"
+  "/root/repo/src/core/extevhan.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/extevhan.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/extevhan.cpp.o.d"
+  "/root/repo/src/core/fbcontainer.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/fbcontainer.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/fbcontainer.cpp.o.d"
+  "/root/repo/src/core/fbportindex.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/fbportindex.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/fbportindex.cpp.o.d"
+  "/root/repo/src/core/funcbloc.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/funcbloc.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/funcbloc.cpp.o.d"
+  "/root/repo/src/core/iec61131_functions.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/iec61131_functions.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/iec61131_functions.cpp.o.d"
+  "/root/repo/src/core/if2indco.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/if2indco.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/if2indco.cpp.o.d"
+  "/root/repo/src/core/monitoring.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/monitoring.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/monitoring.cpp.o.d"
+  "/root/repo/src/core/resource.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/resource.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/resource.cpp.o.d"
+  "/root/repo/src/core/simplefb.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/simplefb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/simplefb.cpp.o.d"
+  "/root/repo/src/core/stringdict.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/stringdict.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/stringdict.cpp.o.d"
+  "/root/repo/src/core/typelib.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/typelib.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/typelib.cpp.o.d"
+  "/root/repo/src/core/utils/alloccheck.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/alloccheck.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/alloccheck.cpp.o.d"
+  "/root/repo/src/core/utils/configFileParser.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/configFileParser.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/configFileParser.cpp.o.d"
+  "/root/repo/src/core/utils/forte_byteswap.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/forte_byteswap.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/forte_byteswap.cpp.o.d"
+  "/root/repo/src/core/utils/parameterParser.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/parameterParser.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/parameterParser.cpp.o.d"
+  "/root/repo/src/core/utils/string_utils.cpp" "src/CMakeFiles/FORTE_LITE.dir/core/utils/string_utils.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/core/utils/string_utils.cpp.o.d"
+  "/root/repo/src/modules/convert/BOOL2BOOL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/BOOL2BOOL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/BOOL2BOOL.cpp.o.d"
+  "/root/repo/src/modules/convert/BYTE2BYTE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/BYTE2BYTE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/BYTE2BYTE.cpp.o.d"
+  "/root/repo/src/modules/convert/DINT2DINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/DINT2DINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/DINT2DINT.cpp.o.d"
+  "/root/repo/src/modules/convert/DWORD2DWORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/DWORD2DWORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/DWORD2DWORD.cpp.o.d"
+  "/root/repo/src/modules/convert/GEN_STRUCT_DEMUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_DEMUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_DEMUX.cpp.o.d"
+  "/root/repo/src/modules/convert/GEN_STRUCT_MUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_MUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_MUX.cpp.o.d"
+  "/root/repo/src/modules/convert/INT2INT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/INT2INT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/INT2INT.cpp.o.d"
+  "/root/repo/src/modules/convert/LREAL2LREAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/LREAL2LREAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/LREAL2LREAL.cpp.o.d"
+  "/root/repo/src/modules/convert/REAL2REAL.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/REAL2REAL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/REAL2REAL.cpp.o.d"
+  "/root/repo/src/modules/convert/SINT2SINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/SINT2SINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/SINT2SINT.cpp.o.d"
+  "/root/repo/src/modules/convert/STRING2STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/STRING2STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/STRING2STRING.cpp.o.d"
+  "/root/repo/src/modules/convert/TIME2TIME.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/TIME2TIME.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/TIME2TIME.cpp.o.d"
+  "/root/repo/src/modules/convert/UDINT2UDINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/UDINT2UDINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/UDINT2UDINT.cpp.o.d"
+  "/root/repo/src/modules/convert/UINT2UINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/UINT2UINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/UINT2UINT.cpp.o.d"
+  "/root/repo/src/modules/convert/USINT2USINT.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/USINT2USINT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/USINT2USINT.cpp.o.d"
+  "/root/repo/src/modules/convert/WORD2WORD.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/WORD2WORD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/WORD2WORD.cpp.o.d"
+  "/root/repo/src/modules/convert/WSTRING2WSTRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/WSTRING2WSTRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/convert/WSTRING2WSTRING.cpp.o.d"
+  "/root/repo/src/modules/utils/E_STOPWATCH.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/E_STOPWATCH.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/E_STOPWATCH.cpp.o.d"
+  "/root/repo/src/modules/utils/FB_RANDOM.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/FB_RANDOM.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/FB_RANDOM.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_APPEND_STRING.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_APPEND_STRING.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_APPEND_STRING.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_ARRAY2ARRAY.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2ARRAY.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2ARRAY.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_ARRAY2VALUES.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2VALUES.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2VALUES.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_CSV_WRITER.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_CSV_WRITER.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_CSV_WRITER.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_F_MUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_F_MUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_F_MUX.cpp.o.d"
+  "/root/repo/src/modules/utils/GEN_VALUES2ARRAY.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_VALUES2ARRAY.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_VALUES2ARRAY.cpp.o.d"
+  "/root/repo/src/modules/utils/GET_AT_INDEX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GET_AT_INDEX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GET_AT_INDEX.cpp.o.d"
+  "/root/repo/src/modules/utils/GET_STRUCT_VALUE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GET_STRUCT_VALUE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/GET_STRUCT_VALUE.cpp.o.d"
+  "/root/repo/src/modules/utils/OUT_ANY_CONSOLE.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/OUT_ANY_CONSOLE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/OUT_ANY_CONSOLE.cpp.o.d"
+  "/root/repo/src/modules/utils/SET_AT_INDEX.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/SET_AT_INDEX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/SET_AT_INDEX.cpp.o.d"
+  "/root/repo/src/modules/utils/STEST_END.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/STEST_END.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/STEST_END.cpp.o.d"
+  "/root/repo/src/modules/utils/TEST_CONDITION.cpp" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/TEST_CONDITION.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/modules/utils/TEST_CONDITION.cpp.o.d"
+  "/root/repo/src/stdfblib/events/ARTimeOut.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/ARTimeOut.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/ARTimeOut.cpp.o.d"
+  "/root/repo/src/stdfblib/events/ATimeOut.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/ATimeOut.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/ATimeOut.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_CTD.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTD.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_CTU.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTU.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTU.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_CTUD.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTUD.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTUD.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_CYCLE.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CYCLE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CYCLE.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_DELAY.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DELAY.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DELAY.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_DEMUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DEMUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DEMUX.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_D_FF.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_D_FF.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_D_FF.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_F_TRIG.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_F_TRIG.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_F_TRIG.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_MERGE.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_MERGE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_MERGE.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_PERMIT.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_PERMIT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_PERMIT.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_RDELAY.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RDELAY.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RDELAY.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_REND.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_REND.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_REND.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_RESTART.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RESTART.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RESTART.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_RS.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RS.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RS.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_RTimeOut.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RTimeOut.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RTimeOut.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_R_TRIG.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_R_TRIG.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_R_TRIG.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_SELECT.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SELECT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SELECT.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_SPLIT.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SPLIT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SPLIT.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_SR.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SR.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_SWITCH.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SWITCH.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SWITCH.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_TRAIN.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TRAIN.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TRAIN.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_T_FF.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_T_FF.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_T_FF.cpp.o.d"
+  "/root/repo/src/stdfblib/events/E_TimeOut.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TimeOut.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TimeOut.cpp.o.d"
+  "/root/repo/src/stdfblib/events/GEN_E_DEMUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_DEMUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_DEMUX.cpp.o.d"
+  "/root/repo/src/stdfblib/events/GEN_E_MUX.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_MUX.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_MUX.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/DEV_MGR.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/DEV_MGR.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/DEV_MGR.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/EMB_RES.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/EMB_RES.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/EMB_RES.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/ForteBinaryBootFile.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBinaryBootFile.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBinaryBootFile.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/ForteBootFileLoader.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBootFileLoader.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBootFileLoader.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/RMT_DEV.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_DEV.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_DEV.cpp.o.d"
+  "/root/repo/src/stdfblib/ita/RMT_RES.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_RES.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_RES.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_CLIENT.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_CLIENT.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_CLIENT.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_PUBL.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBL.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_PUBLISH.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBLISH.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBLISH.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_SERVER.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SERVER.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SERVER.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_SUBL.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBL.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBL.cpp.o.d"
+  "/root/repo/src/stdfblib/net/GEN_SUBSCRIBE.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBSCRIBE.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBSCRIBE.cpp.o.d"
+  "/root/repo/src/stdfblib/timedfb.cpp" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/timedfb.cpp.o" "gcc" "src/CMakeFiles/FORTE_LITE.dir/stdfblib/timedfb.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,327 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FORTE_LITE.dir/__/core/cominfra/comlayersmanager.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/__/core/cominfra/comlayersmanager.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/__/core/deviceExecutionHandlers.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/__/core/deviceExecutionHandlers.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/__/forteinit.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/__/forteinit.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/__/stringlist.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/__/stringlist.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/asynclogger.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/asynclogger.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/bsdsocketinterf.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/bsdsocketinterf.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/devlog.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/devlog.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/fdselecthand.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/fdselecthand.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/genforte_printer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/genforte_printer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/genforte_realFunctions.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/genforte_realFunctions.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_architecture_time.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_architecture_time.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sem.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sem.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sync.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_sync.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_thread.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/forte_thread.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/pctimeha.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/pctimeha.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/poolalloc.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/posix/poolalloc.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/timerha.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/timerha.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/timingwheel.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/timingwheel.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/utils/mainparam_utils.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/utils/mainparam_utils.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/arch/utils/timespec_utils.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/arch/utils/timespec_utils.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/adapter.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/adapter.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/adapterconn.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/adapterconn.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/anyadapter.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/anyadapter.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/basicfb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/basicfb.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cfb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cfb.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/basecommfb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/basecommfb.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/comlayer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/comlayer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/commfb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/commfb.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/fbdkasn1layer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/fbdkasn1layer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/ipcomlayer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/ipcomlayer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/localcomlayer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/localcomlayer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/rawdatacomlayer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/rawdatacomlayer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/udpsendbatch.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/cominfra/udpsendbatch.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/conn.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/conn.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/dataconn.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/dataconn.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_bit.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_bit.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_date.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_date.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_elementary.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_elementary.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_int.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_int.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_magnitude.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_magnitude.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_num.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_num.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_real.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_real.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_string.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_any_string.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_array.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_array.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_bool.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_bool.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_byte.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_byte.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date_and_time.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_date_and_time.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dword.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_dword.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_int.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_int.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lreal.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lreal.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lword.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_lword.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_real.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_real.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_sint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_sint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_string.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_string.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_struct.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_struct.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time_of_day.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_time_of_day.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_udint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_udint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_uint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_uint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_ulint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_ulint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_usint.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_usint.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_word.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_word.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_wstring.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/forte_wstring.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/unicode_utils.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/datatypes/unicode_utils.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/devexec.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/devexec.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/device.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/device.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/ecet.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/ecet.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/ecetFactory.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/ecetFactory.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/eventconn.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/eventconn.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/extevhan.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/extevhan.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/fbcontainer.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/fbcontainer.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/fbportindex.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/fbportindex.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/funcbloc.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/funcbloc.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/iec61131_functions.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/iec61131_functions.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/if2indco.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/if2indco.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/monitoring.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/monitoring.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/resource.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/resource.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/simplefb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/simplefb.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/stringdict.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/stringdict.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/typelib.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/typelib.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/alloccheck.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/alloccheck.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/configFileParser.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/configFileParser.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/forte_byteswap.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/forte_byteswap.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/parameterParser.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/parameterParser.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/string_utils.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/core/utils/string_utils.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/BOOL2BOOL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/BOOL2BOOL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/BYTE2BYTE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/BYTE2BYTE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/DINT2DINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/DINT2DINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/DWORD2DWORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/DWORD2DWORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_DEMUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_DEMUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_MUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/GEN_STRUCT_MUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/INT2INT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/INT2INT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/LREAL2LREAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/LREAL2LREAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/REAL2REAL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/REAL2REAL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/SINT2SINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/SINT2SINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/STRING2STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/STRING2STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/TIME2TIME.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/TIME2TIME.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/UDINT2UDINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/UDINT2UDINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/UINT2UINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/UINT2UINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/USINT2USINT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/USINT2USINT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/WORD2WORD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/WORD2WORD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/WSTRING2WSTRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/convert/WSTRING2WSTRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/E_STOPWATCH.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/E_STOPWATCH.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/FB_RANDOM.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/FB_RANDOM.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_APPEND_STRING.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_APPEND_STRING.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2ARRAY.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2ARRAY.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2VALUES.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_ARRAY2VALUES.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_CSV_WRITER.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_CSV_WRITER.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_F_MUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_F_MUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_VALUES2ARRAY.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GEN_VALUES2ARRAY.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GET_AT_INDEX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GET_AT_INDEX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GET_STRUCT_VALUE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/GET_STRUCT_VALUE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/OUT_ANY_CONSOLE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/OUT_ANY_CONSOLE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/SET_AT_INDEX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/SET_AT_INDEX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/STEST_END.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/STEST_END.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/TEST_CONDITION.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/modules/utils/TEST_CONDITION.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/ARTimeOut.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/ARTimeOut.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/ATimeOut.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/ATimeOut.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTU.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTU.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTUD.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CTUD.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CYCLE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_CYCLE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DELAY.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DELAY.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DEMUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_DEMUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_D_FF.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_D_FF.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_F_TRIG.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_F_TRIG.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_MERGE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_MERGE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_PERMIT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_PERMIT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RDELAY.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RDELAY.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_REND.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_REND.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RESTART.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RESTART.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RS.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RS.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RTimeOut.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_RTimeOut.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_R_TRIG.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_R_TRIG.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SELECT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SELECT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SPLIT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SPLIT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SWITCH.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_SWITCH.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TRAIN.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TRAIN.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_T_FF.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_T_FF.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TimeOut.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/E_TimeOut.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_DEMUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_DEMUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_MUX.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/events/GEN_E_MUX.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/DEV_MGR.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/DEV_MGR.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/EMB_RES.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/EMB_RES.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBinaryBootFile.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBinaryBootFile.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBootFileLoader.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/ForteBootFileLoader.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_DEV.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_DEV.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_RES.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/ita/RMT_RES.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_CLIENT.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_CLIENT.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBLISH.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_PUBLISH.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SERVER.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SERVER.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBL.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBL.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBSCRIBE.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/net/GEN_SUBSCRIBE.cpp.o.d"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/timedfb.cpp.o"
+  "CMakeFiles/FORTE_LITE.dir/stdfblib/timedfb.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FORTE_LITE.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
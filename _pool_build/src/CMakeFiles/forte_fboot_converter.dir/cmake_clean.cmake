@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/forte_fboot_converter.dir/__/tools/fbootconverter/forte_fboot_converter.cpp.o"
+  "CMakeFiles/forte_fboot_converter.dir/__/tools/fbootconverter/forte_fboot_converter.cpp.o.d"
+  "forte_fboot_converter"
+  "forte_fboot_converter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/forte_fboot_converter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ * Copyright (c) 2012 Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Michael Hofmann
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+ extern const CStringDictionary::TStringId g_nStringIdBOOL;
+ extern const CStringDictionary::TStringId g_nStringIdCFB_TEST;
+ extern const CStringDictionary::TStringId g_nStringIdCHANGED;
+ extern const CStringDictionary::TStringId g_nStringIdCNF;
+ extern const CStringDictionary::TStringId g_nStringIdEI;
+ extern const CStringDictionary::TStringId g_nStringIdEI1;
+ extern const CStringDictionary::TStringId g_nStringIdEI2;
+ extern const CStringDictionary::TStringId g_nStringIdEO;
+ extern const CStringDictionary::TStringId g_nStringIdEO0;
+ extern const CStringDictionary::TStringId g_nStringIdEO1;
+ extern const CStringDictionary::TStringId g_nStringIdEO2;
+ extern const CStringDictionary::TStringId g_nStringIdE_DEMUX_2;
+ extern const CStringDictionary::TStringId g_nStringIdE_MUX_2;
+ extern const CStringDictionary::TStringId g_nStringIdE_PERMIT;
+ extern const CStringDictionary::TStringId g_nStringIdE_SR;
+ extern const CStringDictionary::TStringId g_nStringIdE_SWITCH;
+ extern const CStringDictionary::TStringId g_nStringIdG;
+ extern const CStringDictionary::TStringId g_nStringIdK;
+ extern const CStringDictionary::TStringId g_nStringIdPERMIT;
+ extern const CStringDictionary::TStringId g_nStringIdPERMIT_OP;
+ extern const CStringDictionary::TStringId g_nStringIdQ;
+ extern const CStringDictionary::TStringId g_nStringIdQI;
+ extern const CStringDictionary::TStringId g_nStringIdR;
+ extern const CStringDictionary::TStringId g_nStringIdRESET;
+ extern const CStringDictionary::TStringId g_nStringIdRESET_CHANGED;
+ extern const CStringDictionary::TStringId g_nStringIdS;
+ extern const CStringDictionary::TStringId g_nStringIdSET;
+ extern const CStringDictionary::TStringId g_nStringIdSET_CHANGED;
+ extern const CStringDictionary::TStringId g_nStringIdSR;
+
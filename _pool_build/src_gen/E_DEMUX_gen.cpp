@@ -0,0 +1,23 @@
+/*******************************************************************************
+ * Copyright (c) 2012 Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Michael Hofmann
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+ extern const CStringDictionary::TStringId g_nStringIdEI;
+ extern const CStringDictionary::TStringId g_nStringIdEO0;
+ extern const CStringDictionary::TStringId g_nStringIdEO1;
+ extern const CStringDictionary::TStringId g_nStringIdEO2;
+ extern const CStringDictionary::TStringId g_nStringIdEO3;
+ extern const CStringDictionary::TStringId g_nStringIdE_DEMUX;
+ extern const CStringDictionary::TStringId g_nStringIdK;
+ extern const CStringDictionary::TStringId g_nStringIdUINT;
+
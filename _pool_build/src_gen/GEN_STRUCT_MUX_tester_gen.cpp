@@ -0,0 +1,23 @@
+/*******************************************************************************
+ * Copyright (c) 2012 Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Michael Hofmann
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+ extern const CStringDictionary::TStringId g_nStringIdInstanceName;
+ extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1REAL;
+ extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1STRING;
+ extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_1;
+ extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_2;
+ extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_3;
+ extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_4;
+ extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1UnknownType;
+
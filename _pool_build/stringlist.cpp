@@ -0,0 +1,499 @@
+/*******************************************************************************
+ * Copyright (c) 2010 - 2012 ACIN, Profactor GmbH
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0.
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Michael Hofmann, Alois Zoitl, Ingo Hegny
+ *     - initial API and implementation and/or initial documentation
+ *******************************************************************************/
+
+//!!!autogenerated code - DO NOT EDIT!!!
+#include "stringlist.h"
+
+extern const CStringDictionary::TStringId g_nStringIdANY = 0;
+extern const CStringDictionary::TStringId g_nStringIdANY_ADAPTER = 4;
+extern const CStringDictionary::TStringId g_nStringIdANY_BIT = 16;
+extern const CStringDictionary::TStringId g_nStringIdANY_ELEMENTARY = 24;
+extern const CStringDictionary::TStringId g_nStringIdANY_INT = 39;
+extern const CStringDictionary::TStringId g_nStringIdANY_MAGNITUDE = 47;
+extern const CStringDictionary::TStringId g_nStringIdANY_NUM = 61;
+extern const CStringDictionary::TStringId g_nStringIdANY_REAL = 69;
+extern const CStringDictionary::TStringId g_nStringIdANY_STRING = 78;
+extern const CStringDictionary::TStringId g_nStringIdARRAY = 89;
+extern const CStringDictionary::TStringId g_nStringIdARTimeOut = 95;
+extern const CStringDictionary::TStringId g_nStringIdATimeOut = 105;
+extern const CStringDictionary::TStringId g_nStringIdArrayOfStructTest = 114;
+extern const CStringDictionary::TStringId g_nStringIdBOOL = 132;
+extern const CStringDictionary::TStringId g_nStringIdBOOL2BOOL = 137;
+extern const CStringDictionary::TStringId g_nStringIdBYTE = 147;
+extern const CStringDictionary::TStringId g_nStringIdBYTE2BYTE = 152;
+extern const CStringDictionary::TStringId g_nStringIdCD = 162;
+extern const CStringDictionary::TStringId g_nStringIdCDO = 165;
+extern const CStringDictionary::TStringId g_nStringIdCFB_TEST = 169;
+extern const CStringDictionary::TStringId g_nStringIdCHANGED = 178;
+extern const CStringDictionary::TStringId g_nStringIdCLK = 186;
+extern const CStringDictionary::TStringId g_nStringIdCNF = 190;
+extern const CStringDictionary::TStringId g_nStringIdCO = 194;
+extern const CStringDictionary::TStringId g_nStringIdCOLD = 197;
+extern const CStringDictionary::TStringId g_nStringIdCTR = 202;
+extern const CStringDictionary::TStringId g_nStringIdCU = 206;
+extern const CStringDictionary::TStringId g_nStringIdCUO = 209;
+extern const CStringDictionary::TStringId g_nStringIdCV = 213;
+extern const CStringDictionary::TStringId g_nStringIdD = 216;
+extern const CStringDictionary::TStringId g_nStringIdDATE = 218;
+extern const CStringDictionary::TStringId g_nStringIdDATE_AND_TIME = 223;
+extern const CStringDictionary::TStringId g_nStringIdDEV_MGR = 237;
+extern const CStringDictionary::TStringId g_nStringIdDINT = 245;
+extern const CStringDictionary::TStringId g_nStringIdDINT2DINT = 250;
+extern const CStringDictionary::TStringId g_nStringIdDLY = 260;
+extern const CStringDictionary::TStringId g_nStringIdDST = 264;
+extern const CStringDictionary::TStringId g_nStringIdDT = 268;
+extern const CStringDictionary::TStringId g_nStringIdDWORD = 271;
+extern const CStringDictionary::TStringId g_nStringIdDWORD2DWORD = 277;
+extern const CStringDictionary::TStringId g_nStringIdEI = 289;
+extern const CStringDictionary::TStringId g_nStringIdEI0 = 292;
+extern const CStringDictionary::TStringId g_nStringIdEI1 = 296;
+extern const CStringDictionary::TStringId g_nStringIdEI2 = 300;
+extern const CStringDictionary::TStringId g_nStringIdEMB_RES = 304;
+extern const CStringDictionary::TStringId g_nStringIdEO = 312;
+extern const CStringDictionary::TStringId g_nStringIdEO0 = 315;
+extern const CStringDictionary::TStringId g_nStringIdEO1 = 319;
+extern const CStringDictionary::TStringId g_nStringIdEO2 = 323;
+extern const CStringDictionary::TStringId g_nStringIdEO3 = 327;
+extern const CStringDictionary::TStringId g_nStringIdE_CTD = 331;
+extern const CStringDictionary::TStringId g_nStringIdE_CTU = 337;
+extern const CStringDictionary::TStringId g_nStringIdE_CTUD = 343;
+extern const CStringDictionary::TStringId g_nStringIdE_CYCLE = 350;
+extern const CStringDictionary::TStringId g_nStringIdE_DELAY = 358;
+extern const CStringDictionary::TStringId g_nStringIdE_DEMUX = 366;
+extern const CStringDictionary::TStringId g_nStringIdE_DEMUX_2 = 374;
+extern const CStringDictionary::TStringId g_nStringIdE_D_FF = 384;
+extern const CStringDictionary::TStringId g_nStringIdE_F_TRIG = 391;
+extern const CStringDictionary::TStringId g_nStringIdE_MERGE = 400;
+extern const CStringDictionary::TStringId g_nStringIdE_MUX_2 = 408;
+extern const CStringDictionary::TStringId g_nStringIdE_PERMIT = 416;
+extern const CStringDictionary::TStringId g_nStringIdE_RDELAY = 425;
+extern const CStringDictionary::TStringId g_nStringIdE_REND = 434;
+extern const CStringDictionary::TStringId g_nStringIdE_RESTART = 441;
+extern const CStringDictionary::TStringId g_nStringIdE_RS = 451;
+extern const CStringDictionary::TStringId g_nStringIdE_RTimeOut = 456;
+extern const CStringDictionary::TStringId g_nStringIdE_R_TRIG = 467;
+extern const CStringDictionary::TStringId g_nStringIdE_SELECT = 476;
+extern const CStringDictionary::TStringId g_nStringIdE_SPLIT = 485;
+extern const CStringDictionary::TStringId g_nStringIdE_SR = 493;
+extern const CStringDictionary::TStringId g_nStringIdE_STOPWATCH = 498;
+extern const CStringDictionary::TStringId g_nStringIdE_SWITCH = 510;
+extern const CStringDictionary::TStringId g_nStringIdE_TRAIN = 519;
+extern const CStringDictionary::TStringId g_nStringIdE_T_FF = 527;
+extern const CStringDictionary::TStringId g_nStringIdE_TimeOut = 534;
+extern const CStringDictionary::TStringId g_nStringIdFB_RANDOM = 544;
+extern const CStringDictionary::TStringId g_nStringIdFILE_NAME = 554;
+extern const CStringDictionary::TStringId g_nStringIdG = 564;
+extern const CStringDictionary::TStringId g_nStringIdGATE = 566;
+extern const CStringDictionary::TStringId g_nStringIdGEN_APPEND_STRING = 571;
+extern const CStringDictionary::TStringId g_nStringIdGEN_ARRAY2ARRAY = 589;
+extern const CStringDictionary::TStringId g_nStringIdGEN_ARRAY2VALUES = 605;
+extern const CStringDictionary::TStringId g_nStringIdGEN_CLIENT = 622;
+extern const CStringDictionary::TStringId g_nStringIdGEN_CSV_WRITER = 633;
+extern const CStringDictionary::TStringId g_nStringIdGEN_E_DEMUX = 648;
+extern const CStringDictionary::TStringId g_nStringIdGEN_E_MUX = 660;
+extern const CStringDictionary::TStringId g_nStringIdGEN_F_MUX = 670;
+extern const CStringDictionary::TStringId g_nStringIdGEN_PUBL = 680;
+extern const CStringDictionary::TStringId g_nStringIdGEN_PUBLISH = 689;
+extern const CStringDictionary::TStringId g_nStringIdGEN_SERVER = 701;
+extern const CStringDictionary::TStringId g_nStringIdGEN_STRUCT_DEMUX = 712;
+extern const CStringDictionary::TStringId g_nStringIdGEN_STRUCT_MUX = 729;
+extern const CStringDictionary::TStringId g_nStringIdGEN_SUBL = 744;
+extern const CStringDictionary::TStringId g_nStringIdGEN_SUBSCRIBE = 753;
+extern const CStringDictionary::TStringId g_nStringIdGEN_VALUES2ARRAY = 767;
+extern const CStringDictionary::TStringId g_nStringIdGET_AT_INDEX = 784;
+extern const CStringDictionary::TStringId g_nStringIdGET_STRUCT_VALUE = 797;
+extern const CStringDictionary::TStringId g_nStringIdGET_STRUCT_VALUE_Struct_test1 = 814;
+extern const CStringDictionary::TStringId g_nStringIdGET_STRUCT_VALUE_Struct_test2 = 844;
+extern const CStringDictionary::TStringId g_nStringIdID = 874;
+extern const CStringDictionary::TStringId g_nStringIdIN = 877;
+extern const CStringDictionary::TStringId g_nStringIdIND = 880;
+extern const CStringDictionary::TStringId g_nStringIdINDEX = 884;
+extern const CStringDictionary::TStringId g_nStringIdINIT = 890;
+extern const CStringDictionary::TStringId g_nStringIdINITO = 895;
+extern const CStringDictionary::TStringId g_nStringIdINT = 901;
+extern const CStringDictionary::TStringId g_nStringIdINT2INT = 905;
+extern const CStringDictionary::TStringId g_nStringIdIN_ARRAY = 913;
+extern const CStringDictionary::TStringId g_nStringIdInstanceName = 922;
+extern const CStringDictionary::TStringId g_nStringIdK = 935;
+extern const CStringDictionary::TStringId g_nStringIdLABEL = 937;
+extern const CStringDictionary::TStringId g_nStringIdLD = 943;
+extern const CStringDictionary::TStringId g_nStringIdLDO = 946;
+extern const CStringDictionary::TStringId g_nStringIdLINT = 950;
+extern const CStringDictionary::TStringId g_nStringIdLOWERCASETEST = 955;
+extern const CStringDictionary::TStringId g_nStringIdLREAL = 969;
+extern const CStringDictionary::TStringId g_nStringIdLREAL2LREAL = 975;
+extern const CStringDictionary::TStringId g_nStringIdLWORD = 987;
+extern const CStringDictionary::TStringId g_nStringIdMGR = 993;
+extern const CStringDictionary::TStringId g_nStringIdMGR_FF = 997;
+extern const CStringDictionary::TStringId g_nStringIdMGR_ID = 1004;
+extern const CStringDictionary::TStringId g_nStringIdN = 1011;
+extern const CStringDictionary::TStringId g_nStringIdOUT = 1013;
+extern const CStringDictionary::TStringId g_nStringIdOUT_ANY_CONSOLE = 1017;
+extern const CStringDictionary::TStringId g_nStringIdOUT_ARRAY = 1033;
+extern const CStringDictionary::TStringId g_nStringIdPERMIT = 1043;
+extern const CStringDictionary::TStringId g_nStringIdPERMIT_OP = 1050;
+extern const CStringDictionary::TStringId g_nStringIdPV = 1060;
+extern const CStringDictionary::TStringId g_nStringIdQ = 1063;
+extern const CStringDictionary::TStringId g_nStringIdQD = 1065;
+extern const CStringDictionary::TStringId g_nStringIdQI = 1068;
+extern const CStringDictionary::TStringId g_nStringIdQO = 1071;
+extern const CStringDictionary::TStringId g_nStringIdQU = 1074;
+extern const CStringDictionary::TStringId g_nStringIdR = 1077;
+extern const CStringDictionary::TStringId g_nStringIdREAL = 1079;
+extern const CStringDictionary::TStringId g_nStringIdREAL2REAL = 1084;
+extern const CStringDictionary::TStringId g_nStringIdREQ = 1094;
+extern const CStringDictionary::TStringId g_nStringIdRESET = 1098;
+extern const CStringDictionary::TStringId g_nStringIdRESET_CHANGED = 1104;
+extern const CStringDictionary::TStringId g_nStringIdRESP = 1118;
+extern const CStringDictionary::TStringId g_nStringIdRMT_RES = 1123;
+extern const CStringDictionary::TStringId g_nStringIdRO = 1131;
+extern const CStringDictionary::TStringId g_nStringIdRQST = 1134;
+extern const CStringDictionary::TStringId g_nStringIdRSP = 1139;
+extern const CStringDictionary::TStringId g_nStringIdS = 1143;
+extern const CStringDictionary::TStringId g_nStringIdSEED = 1145;
+extern const CStringDictionary::TStringId g_nStringIdSET = 1150;
+extern const CStringDictionary::TStringId g_nStringIdSET_AT_INDEX = 1154;
+extern const CStringDictionary::TStringId g_nStringIdSET_CHANGED = 1167;
+extern const CStringDictionary::TStringId g_nStringIdSINT = 1179;
+extern const CStringDictionary::TStringId g_nStringIdSINT2SINT = 1184;
+extern const CStringDictionary::TStringId g_nStringIdSR = 1194;
+extern const CStringDictionary::TStringId g_nStringIdSTART = 1197;
+extern const CStringDictionary::TStringId g_nStringIdSTATUS = 1203;
+extern const CStringDictionary::TStringId g_nStringIdSTEST_END = 1210;
+extern const CStringDictionary::TStringId g_nStringIdSTOP = 1220;
+extern const CStringDictionary::TStringId g_nStringIdSTRING = 1225;
+extern const CStringDictionary::TStringId g_nStringIdSTRING2STRING = 1232;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1REAL = 1246;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1STRING = 1265;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1Struct_Muxer_Test_Struct_1 = 1286;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1Struct_Muxer_Test_Struct_2 = 1327;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1Struct_Muxer_Test_Struct_3 = 1368;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1Struct_Muxer_Test_Struct_4 = 1409;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_DEMUX_1UnknownType = 1450;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1REAL = 1476;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1STRING = 1493;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_1 = 1512;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_2 = 1551;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_3 = 1590;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1Struct_Muxer_Test_Struct_4 = 1629;
+extern const CStringDictionary::TStringId g_nStringIdSTRUCT_MUX_1UnknownType = 1668;
+extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_1 = 1692;
+extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_2 = 1719;
+extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_3 = 1746;
+extern const CStringDictionary::TStringId g_nStringIdStruct_Muxer_Test_Struct_4 = 1773;
+extern const CStringDictionary::TStringId g_nStringIdTD = 1800;
+extern const CStringDictionary::TStringId g_nStringIdTEST_CONDITION = 1803;
+extern const CStringDictionary::TStringId g_nStringIdTIME = 1818;
+extern const CStringDictionary::TStringId g_nStringIdTIME2TIME = 1823;
+extern const CStringDictionary::TStringId g_nStringIdTIME_OF_DAY = 1833;
+extern const CStringDictionary::TStringId g_nStringIdTestStruct1 = 1845;
+extern const CStringDictionary::TStringId g_nStringIdTestStruct2 = 1857;
+extern const CStringDictionary::TStringId g_nStringIdTestStruct3 = 1869;
+extern const CStringDictionary::TStringId g_nStringIdTestStruct4 = 1881;
+extern const CStringDictionary::TStringId g_nStringIdTimeOut = 1893;
+extern const CStringDictionary::TStringId g_nStringIdTimeOutSocket = 1901;
+extern const CStringDictionary::TStringId g_nStringIdUDINT = 1915;
+extern const CStringDictionary::TStringId g_nStringIdUDINT2UDINT = 1921;
+extern const CStringDictionary::TStringId g_nStringIdUINT = 1933;
+extern const CStringDictionary::TStringId g_nStringIdUINT2UINT = 1938;
+extern const CStringDictionary::TStringId g_nStringIdULINT = 1948;
+extern const CStringDictionary::TStringId g_nStringIdUNDEFINEDDATATYPE = 1954;
+extern const CStringDictionary::TStringId g_nStringIdUSINT = 1972;
+extern const CStringDictionary::TStringId g_nStringIdUSINT2USINT = 1978;
+extern const CStringDictionary::TStringId g_nStringIdVAL = 1990;
+extern const CStringDictionary::TStringId g_nStringIdVALUE = 1994;
+extern const CStringDictionary::TStringId g_nStringIdVal1 = 2000;
+extern const CStringDictionary::TStringId g_nStringIdVal2 = 2005;
+extern const CStringDictionary::TStringId g_nStringIdVal3 = 2010;
+extern const CStringDictionary::TStringId g_nStringIdVal4 = 2015;
+extern const CStringDictionary::TStringId g_nStringIdVar0 = 2020;
+extern const CStringDictionary::TStringId g_nStringIdVar1 = 2025;
+extern const CStringDictionary::TStringId g_nStringIdVar10 = 2030;
+extern const CStringDictionary::TStringId g_nStringIdVar100 = 2036;
+extern const CStringDictionary::TStringId g_nStringIdVar101 = 2043;
+extern const CStringDictionary::TStringId g_nStringIdVar102 = 2050;
+extern const CStringDictionary::TStringId g_nStringIdVar103 = 2057;
+extern const CStringDictionary::TStringId g_nStringIdVar104 = 2064;
+extern const CStringDictionary::TStringId g_nStringIdVar105 = 2071;
+extern const CStringDictionary::TStringId g_nStringIdVar106 = 2078;
+extern const CStringDictionary::TStringId g_nStringIdVar107 = 2085;
+extern const CStringDictionary::TStringId g_nStringIdVar108 = 2092;
+extern const CStringDictionary::TStringId g_nStringIdVar109 = 2099;
+extern const CStringDictionary::TStringId g_nStringIdVar11 = 2106;
+extern const CStringDictionary::TStringId g_nStringIdVar110 = 2112;
+extern const CStringDictionary::TStringId g_nStringIdVar111 = 2119;
+extern const CStringDictionary::TStringId g_nStringIdVar112 = 2126;
+extern const CStringDictionary::TStringId g_nStringIdVar113 = 2133;
+extern const CStringDictionary::TStringId g_nStringIdVar114 = 2140;
+extern const CStringDictionary::TStringId g_nStringIdVar115 = 2147;
+extern const CStringDictionary::TStringId g_nStringIdVar116 = 2154;
+extern const CStringDictionary::TStringId g_nStringIdVar117 = 2161;
+extern const CStringDictionary::TStringId g_nStringIdVar118 = 2168;
+extern const CStringDictionary::TStringId g_nStringIdVar119 = 2175;
+extern const CStringDictionary::TStringId g_nStringIdVar12 = 2182;
+extern const CStringDictionary::TStringId g_nStringIdVar120 = 2188;
+extern const CStringDictionary::TStringId g_nStringIdVar121 = 2195;
+extern const CStringDictionary::TStringId g_nStringIdVar122 = 2202;
+extern const CStringDictionary::TStringId g_nStringIdVar123 = 2209;
+extern const CStringDictionary::TStringId g_nStringIdVar124 = 2216;
+extern const CStringDictionary::TStringId g_nStringIdVar125 = 2223;
+extern const CStringDictionary::TStringId g_nStringIdVar126 = 2230;
+extern const CStringDictionary::TStringId g_nStringIdVar127 = 2237;
+extern const CStringDictionary::TStringId g_nStringIdVar128 = 2244;
+extern const CStringDictionary::TStringId g_nStringIdVar129 = 2251;
+extern const CStringDictionary::TStringId g_nStringIdVar13 = 2258;
+extern const CStringDictionary::TStringId g_nStringIdVar130 = 2264;
+extern const CStringDictionary::TStringId g_nStringIdVar131 = 2271;
+extern const CStringDictionary::TStringId g_nStringIdVar132 = 2278;
+extern const CStringDictionary::TStringId g_nStringIdVar133 = 2285;
+extern const CStringDictionary::TStringId g_nStringIdVar134 = 2292;
+extern const CStringDictionary::TStringId g_nStringIdVar135 = 2299;
+extern const CStringDictionary::TStringId g_nStringIdVar136 = 2306;
+extern const CStringDictionary::TStringId g_nStringIdVar137 = 2313;
+extern const CStringDictionary::TStringId g_nStringIdVar138 = 2320;
+extern const CStringDictionary::TStringId g_nStringIdVar139 = 2327;
+extern const CStringDictionary::TStringId g_nStringIdVar14 = 2334;
+extern const CStringDictionary::TStringId g_nStringIdVar140 = 2340;
+extern const CStringDictionary::TStringId g_nStringIdVar141 = 2347;
+extern const CStringDictionary::TStringId g_nStringIdVar142 = 2354;
+extern const CStringDictionary::TStringId g_nStringIdVar143 = 2361;
+extern const CStringDictionary::TStringId g_nStringIdVar144 = 2368;
+extern const CStringDictionary::TStringId g_nStringIdVar145 = 2375;
+extern const CStringDictionary::TStringId g_nStringIdVar146 = 2382;
+extern const CStringDictionary::TStringId g_nStringIdVar147 = 2389;
+extern const CStringDictionary::TStringId g_nStringIdVar148 = 2396;
+extern const CStringDictionary::TStringId g_nStringIdVar149 = 2403;
+extern const CStringDictionary::TStringId g_nStringIdVar15 = 2410;
+extern const CStringDictionary::TStringId g_nStringIdVar150 = 2416;
+extern const CStringDictionary::TStringId g_nStringIdVar151 = 2423;
+extern const CStringDictionary::TStringId g_nStringIdVar152 = 2430;
+extern const CStringDictionary::TStringId g_nStringIdVar153 = 2437;
+extern const CStringDictionary::TStringId g_nStringIdVar154 = 2444;
+extern const CStringDictionary::TStringId g_nStringIdVar155 = 2451;
+extern const CStringDictionary::TStringId g_nStringIdVar156 = 2458;
+extern const CStringDictionary::TStringId g_nStringIdVar157 = 2465;
+extern const CStringDictionary::TStringId g_nStringIdVar158 = 2472;
+extern const CStringDictionary::TStringId g_nStringIdVar159 = 2479;
+extern const CStringDictionary::TStringId g_nStringIdVar16 = 2486;
+extern const CStringDictionary::TStringId g_nStringIdVar160 = 2492;
+extern const CStringDictionary::TStringId g_nStringIdVar161 = 2499;
+extern const CStringDictionary::TStringId g_nStringIdVar162 = 2506;
+extern const CStringDictionary::TStringId g_nStringIdVar163 = 2513;
+extern const CStringDictionary::TStringId g_nStringIdVar164 = 2520;
+extern const CStringDictionary::TStringId g_nStringIdVar165 = 2527;
+extern const CStringDictionary::TStringId g_nStringIdVar166 = 2534;
+extern const CStringDictionary::TStringId g_nStringIdVar167 = 2541;
+extern const CStringDictionary::TStringId g_nStringIdVar168 = 2548;
+extern const CStringDictionary::TStringId g_nStringIdVar169 = 2555;
+extern const CStringDictionary::TStringId g_nStringIdVar17 = 2562;
+extern const CStringDictionary::TStringId g_nStringIdVar170 = 2568;
+extern const CStringDictionary::TStringId g_nStringIdVar171 = 2575;
+extern const CStringDictionary::TStringId g_nStringIdVar172 = 2582;
+extern const CStringDictionary::TStringId g_nStringIdVar173 = 2589;
+extern const CStringDictionary::TStringId g_nStringIdVar174 = 2596;
+extern const CStringDictionary::TStringId g_nStringIdVar175 = 2603;
+extern const CStringDictionary::TStringId g_nStringIdVar176 = 2610;
+extern const CStringDictionary::TStringId g_nStringIdVar177 = 2617;
+extern const CStringDictionary::TStringId g_nStringIdVar178 = 2624;
+extern const CStringDictionary::TStringId g_nStringIdVar179 = 2631;
+extern const CStringDictionary::TStringId g_nStringIdVar18 = 2638;
+extern const CStringDictionary::TStringId g_nStringIdVar180 = 2644;
+extern const CStringDictionary::TStringId g_nStringIdVar181 = 2651;
+extern const CStringDictionary::TStringId g_nStringIdVar182 = 2658;
+extern const CStringDictionary::TStringId g_nStringIdVar183 = 2665;
+extern const CStringDictionary::TStringId g_nStringIdVar184 = 2672;
+extern const CStringDictionary::TStringId g_nStringIdVar185 = 2679;
+extern const CStringDictionary::TStringId g_nStringIdVar186 = 2686;
+extern const CStringDictionary::TStringId g_nStringIdVar187 = 2693;
+extern const CStringDictionary::TStringId g_nStringIdVar188 = 2700;
+extern const CStringDictionary::TStringId g_nStringIdVar189 = 2707;
+extern const CStringDictionary::TStringId g_nStringIdVar19 = 2714;
+extern const CStringDictionary::TStringId g_nStringIdVar190 = 2720;
+extern const CStringDictionary::TStringId g_nStringIdVar191 = 2727;
+extern const CStringDictionary::TStringId g_nStringIdVar192 = 2734;
+extern const CStringDictionary::TStringId g_nStringIdVar193 = 2741;
+extern const CStringDictionary::TStringId g_nStringIdVar194 = 2748;
+extern const CStringDictionary::TStringId g_nStringIdVar195 = 2755;
+extern const CStringDictionary::TStringId g_nStringIdVar196 = 2762;
+extern const CStringDictionary::TStringId g_nStringIdVar197 = 2769;
+extern const CStringDictionary::TStringId g_nStringIdVar198 = 2776;
+extern const CStringDictionary::TStringId g_nStringIdVar199 = 2783;
+extern const CStringDictionary::TStringId g_nStringIdVar2 = 2790;
+extern const CStringDictionary::TStringId g_nStringIdVar20 = 2795;
+extern const CStringDictionary::TStringId g_nStringIdVar200 = 2801;
+extern const CStringDictionary::TStringId g_nStringIdVar201 = 2808;
+extern const CStringDictionary::TStringId g_nStringIdVar202 = 2815;
+extern const CStringDictionary::TStringId g_nStringIdVar203 = 2822;
+extern const CStringDictionary::TStringId g_nStringIdVar204 = 2829;
+extern const CStringDictionary::TStringId g_nStringIdVar205 = 2836;
+extern const CStringDictionary::TStringId g_nStringIdVar206 = 2843;
+extern const CStringDictionary::TStringId g_nStringIdVar207 = 2850;
+extern const CStringDictionary::TStringId g_nStringIdVar208 = 2857;
+extern const CStringDictionary::TStringId g_nStringIdVar209 = 2864;
+extern const CStringDictionary::TStringId g_nStringIdVar21 = 2871;
+extern const CStringDictionary::TStringId g_nStringIdVar210 = 2877;
+extern const CStringDictionary::TStringId g_nStringIdVar211 = 2884;
+extern const CStringDictionary::TStringId g_nStringIdVar212 = 2891;
+extern const CStringDictionary::TStringId g_nStringIdVar213 = 2898;
+extern const CStringDictionary::TStringId g_nStringIdVar214 = 2905;
+extern const CStringDictionary::TStringId g_nStringIdVar215 = 2912;
+extern const CStringDictionary::TStringId g_nStringIdVar216 = 2919;
+extern const CStringDictionary::TStringId g_nStringIdVar217 = 2926;
+extern const CStringDictionary::TStringId g_nStringIdVar218 = 2933;
+extern const CStringDictionary::TStringId g_nStringIdVar219 = 2940;
+extern const CStringDictionary::TStringId g_nStringIdVar22 = 2947;
+extern const CStringDictionary::TStringId g_nStringIdVar220 = 2953;
+extern const CStringDictionary::TStringId g_nStringIdVar221 = 2960;
+extern const CStringDictionary::TStringId g_nStringIdVar222 = 2967;
+extern const CStringDictionary::TStringId g_nStringIdVar223 = 2974;
+extern const CStringDictionary::TStringId g_nStringIdVar224 = 2981;
+extern const CStringDictionary::TStringId g_nStringIdVar225 = 2988;
+extern const CStringDictionary::TStringId g_nStringIdVar226 = 2995;
+extern const CStringDictionary::TStringId g_nStringIdVar227 = 3002;
+extern const CStringDictionary::TStringId g_nStringIdVar228 = 3009;
+extern const CStringDictionary::TStringId g_nStringIdVar229 = 3016;
+extern const CStringDictionary::TStringId g_nStringIdVar23 = 3023;
+extern const CStringDictionary::TStringId g_nStringIdVar230 = 3029;
+extern const CStringDictionary::TStringId g_nStringIdVar231 = 3036;
+extern const CStringDictionary::TStringId g_nStringIdVar232 = 3043;
+extern const CStringDictionary::TStringId g_nStringIdVar233 = 3050;
+extern const CStringDictionary::TStringId g_nStringIdVar234 = 3057;
+extern const CStringDictionary::TStringId g_nStringIdVar235 = 3064;
+extern const CStringDictionary::TStringId g_nStringIdVar236 = 3071;
+extern const CStringDictionary::TStringId g_nStringIdVar237 = 3078;
+extern const CStringDictionary::TStringId g_nStringIdVar238 = 3085;
+extern const CStringDictionary::TStringId g_nStringIdVar239 = 3092;
+extern const CStringDictionary::TStringId g_nStringIdVar24 = 3099;
+extern const CStringDictionary::TStringId g_nStringIdVar240 = 3105;
+extern const CStringDictionary::TStringId g_nStringIdVar241 = 3112;
+extern const CStringDictionary::TStringId g_nStringIdVar242 = 3119;
+extern const CStringDictionary::TStringId g_nStringIdVar243 = 3126;
+extern const CStringDictionary::TStringId g_nStringIdVar244 = 3133;
+extern const CStringDictionary::TStringId g_nStringIdVar245 = 3140;
+extern const CStringDictionary::TStringId g_nStringIdVar246 = 3147;
+extern const CStringDictionary::TStringId g_nStringIdVar247 = 3154;
+extern const CStringDictionary::TStringId g_nStringIdVar248 = 3161;
+extern const CStringDictionary::TStringId g_nStringIdVar249 = 3168;
+extern const CStringDictionary::TStringId g_nStringIdVar25 = 3175;
+extern const CStringDictionary::TStringId g_nStringIdVar250 = 3181;
+extern const CStringDictionary::TStringId g_nStringIdVar251 = 3188;
+extern const CStringDictionary::TStringId g_nStringIdVar252 = 3195;
+extern const CStringDictionary::TStringId g_nStringIdVar253 = 3202;
+extern const CStringDictionary::TStringId g_nStringIdVar254 = 3209;
+extern const CStringDictionary::TStringId g_nStringIdVar26 = 3216;
+extern const CStringDictionary::TStringId g_nStringIdVar27 = 3222;
+extern const CStringDictionary::TStringId g_nStringIdVar28 = 3228;
+extern const CStringDictionary::TStringId g_nStringIdVar29 = 3234;
+extern const CStringDictionary::TStringId g_nStringIdVar3 = 3240;
+extern const CStringDictionary::TStringId g_nStringIdVar30 = 3245;
+extern const CStringDictionary::TStringId g_nStringIdVar31 = 3251;
+extern const CStringDictionary::TStringId g_nStringIdVar32 = 3257;
+extern const CStringDictionary::TStringId g_nStringIdVar33 = 3263;
+extern const CStringDictionary::TStringId g_nStringIdVar34 = 3269;
+extern const CStringDictionary::TStringId g_nStringIdVar35 = 3275;
+extern const CStringDictionary::TStringId g_nStringIdVar36 = 3281;
+extern const CStringDictionary::TStringId g_nStringIdVar37 = 3287;
+extern const CStringDictionary::TStringId g_nStringIdVar38 = 3293;
+extern const CStringDictionary::TStringId g_nStringIdVar39 = 3299;
+extern const CStringDictionary::TStringId g_nStringIdVar4 = 3305;
+extern const CStringDictionary::TStringId g_nStringIdVar40 = 3310;
+extern const CStringDictionary::TStringId g_nStringIdVar41 = 3316;
+extern const CStringDictionary::TStringId g_nStringIdVar42 = 3322;
+extern const CStringDictionary::TStringId g_nStringIdVar43 = 3328;
+extern const CStringDictionary::TStringId g_nStringIdVar44 = 3334;
+extern const CStringDictionary::TStringId g_nStringIdVar45 = 3340;
+extern const CStringDictionary::TStringId g_nStringIdVar46 = 3346;
+extern const CStringDictionary::TStringId g_nStringIdVar47 = 3352;
+extern const CStringDictionary::TStringId g_nStringIdVar48 = 3358;
+extern const CStringDictionary::TStringId g_nStringIdVar49 = 3364;
+extern const CStringDictionary::TStringId g_nStringIdVar5 = 3370;
+extern const CStringDictionary::TStringId g_nStringIdVar50 = 3375;
+extern const CStringDictionary::TStringId g_nStringIdVar51 = 3381;
+extern const CStringDictionary::TStringId g_nStringIdVar52 = 3387;
+extern const CStringDictionary::TStringId g_nStringIdVar53 = 3393;
+extern const CStringDictionary::TStringId g_nStringIdVar54 = 3399;
+extern const CStringDictionary::TStringId g_nStringIdVar55 = 3405;
+extern const CStringDictionary::TStringId g_nStringIdVar56 = 3411;
+extern const CStringDictionary::TStringId g_nStringIdVar57 = 3417;
+extern const CStringDictionary::TStringId g_nStringIdVar58 = 3423;
+extern const CStringDictionary::TStringId g_nStringIdVar59 = 3429;
+extern const CStringDictionary::TStringId g_nStringIdVar6 = 3435;
+extern const CStringDictionary::TStringId g_nStringIdVar60 = 3440;
+extern const CStringDictionary::TStringId g_nStringIdVar61 = 3446;
+extern const CStringDictionary::TStringId g_nStringIdVar62 = 3452;
+extern const CStringDictionary::TStringId g_nStringIdVar63 = 3458;
+extern const CStringDictionary::TStringId g_nStringIdVar64 = 3464;
+extern const CStringDictionary::TStringId g_nStringIdVar65 = 3470;
+extern const CStringDictionary::TStringId g_nStringIdVar66 = 3476;
+extern const CStringDictionary::TStringId g_nStringIdVar67 = 3482;
+extern const CStringDictionary::TStringId g_nStringIdVar68 = 3488;
+extern const CStringDictionary::TStringId g_nStringIdVar69 = 3494;
+extern const CStringDictionary::TStringId g_nStringIdVar7 = 3500;
+extern const CStringDictionary::TStringId g_nStringIdVar70 = 3505;
+extern const CStringDictionary::TStringId g_nStringIdVar71 = 3511;
+extern const CStringDictionary::TStringId g_nStringIdVar72 = 3517;
+extern const CStringDictionary::TStringId g_nStringIdVar73 = 3523;
+extern const CStringDictionary::TStringId g_nStringIdVar74 = 3529;
+extern const CStringDictionary::TStringId g_nStringIdVar75 = 3535;
+extern const CStringDictionary::TStringId g_nStringIdVar76 = 3541;
+extern const CStringDictionary::TStringId g_nStringIdVar77 = 3547;
+extern const CStringDictionary::TStringId g_nStringIdVar78 = 3553;
+extern const CStringDictionary::TStringId g_nStringIdVar79 = 3559;
+extern const CStringDictionary::TStringId g_nStringIdVar8 = 3565;
+extern const CStringDictionary::TStringId g_nStringIdVar80 = 3570;
+extern const CStringDictionary::TStringId g_nStringIdVar81 = 3576;
+extern const CStringDictionary::TStringId g_nStringIdVar82 = 3582;
+extern const CStringDictionary::TStringId g_nStringIdVar83 = 3588;
+extern const CStringDictionary::TStringId g_nStringIdVar84 = 3594;
+extern const CStringDictionary::TStringId g_nStringIdVar85 = 3600;
+extern const CStringDictionary::TStringId g_nStringIdVar86 = 3606;
+extern const CStringDictionary::TStringId g_nStringIdVar87 = 3612;
+extern const CStringDictionary::TStringId g_nStringIdVar88 = 3618;
+extern const CStringDictionary::TStringId g_nStringIdVar89 = 3624;
+extern const CStringDictionary::TStringId g_nStringIdVar9 = 3630;
+extern const CStringDictionary::TStringId g_nStringIdVar90 = 3635;
+extern const CStringDictionary::TStringId g_nStringIdVar91 = 3641;
+extern const CStringDictionary::TStringId g_nStringIdVar92 = 3647;
+extern const CStringDictionary::TStringId g_nStringIdVar93 = 3653;
+extern const CStringDictionary::TStringId g_nStringIdVar94 = 3659;
+extern const CStringDictionary::TStringId g_nStringIdVar95 = 3665;
+extern const CStringDictionary::TStringId g_nStringIdVar96 = 3671;
+extern const CStringDictionary::TStringId g_nStringIdVar97 = 3677;
+extern const CStringDictionary::TStringId g_nStringIdVar98 = 3683;
+extern const CStringDictionary::TStringId g_nStringIdVar99 = 3689;
+extern const CStringDictionary::TStringId g_nStringIdWARM = 3695;
+extern const CStringDictionary::TStringId g_nStringIdWORD = 3700;
+extern const CStringDictionary::TStringId g_nStringIdWORD2WORD = 3705;
+extern const CStringDictionary::TStringId g_nStringIdWSTRING = 3715;
+extern const CStringDictionary::TStringId g_nStringIdWSTRING2WSTRING = 3723;
+extern const CStringDictionary::TStringId g_nStringIdcheck = 3739;
+extern const CStringDictionary::TStringId g_nStringIdin_struct = 3745;
+extern const CStringDictionary::TStringId g_nStringIdlowercasetest = 3755;
+extern const CStringDictionary::TStringId g_nStringIdmember = 3769;
+extern const CStringDictionary::TStringId g_nStringIdoutput = 3776;
+extern const CStringDictionary::TStringId g_nStringIdstartTime = 3783;
+extern const CStringDictionary::TStringId g_nStringIdwARM = 3793;
+extern const CStringDictionary::TStringId g_nStringIdNextFreeId = 3798;
+extern const unsigned int cg_nNumOfConstStrings = 469;
+
+
+const CStringDictionary::TStringId CStringDictionary::scm_aunIdList[] = {0, 4, 16, 24, 39, 47, 61, 69, 78, 89, 95, 105, 114, 132, 137, 147, 152, 162, 165, 169, 178, 186, 190, 194, 197, 202, 206, 209, 213, 216, 218, 223, 237, 245, 250, 260, 264, 268, 271, 277, 289, 292, 296, 300, 304, 312, 315, 319, 323, 327, 331, 337, 343, 350, 358, 366, 374, 384, 391, 400, 408, 416, 425, 434, 441, 451, 456, 467, 476, 485, 493, 498, 510, 519, 527, 534, 544, 554, 564, 566, 571, 589, 605, 622, 633, 648, 660, 670, 680, 689, 701, 712, 729, 744, 753, 767, 784, 797, 814, 844, 874, 877, 880, 884, 890, 895, 901, 905, 913, 922, 935, 937, 943, 946, 950, 955, 969, 975, 987, 993, 997, 1004, 1011, 1013, 1017, 1033, 1043, 1050, 1060, 1063, 1065, 1068, 1071, 1074, 1077, 1079, 1084, 1094, 1098, 1104, 1118, 1123, 1131, 1134, 1139, 1143, 1145, 1150, 1154, 1167, 1179, 1184, 1194, 1197, 1203, 1210, 1220, 1225, 1232, 1246, 1265, 1286, 1327, 1368, 1409, 1450, 1476, 1493, 1512, 1551, 1590, 1629, 1668, 1692, 1719, 1746, 1773, 1800, 1803, 1818, 1823, 1833, 1845, 1857, 1869, 1881, 1893, 1901, 1915, 1921, 1933, 1938, 1948, 1954, 1972, 1978, 1990, 1994, 2000, 2005, 2010, 2015, 2020, 2025, 2030, 2036, 2043, 2050, 2057, 2064, 2071, 2078, 2085, 2092, 2099, 2106, 2112, 2119, 2126, 2133, 2140, 2147, 2154, 2161, 2168, 2175, 2182, 2188, 2195, 2202, 2209, 2216, 2223, 2230, 2237, 2244, 2251, 2258, 2264, 2271, 2278, 2285, 2292, 2299, 2306, 2313, 2320, 2327, 2334, 2340, 2347, 2354, 2361, 2368, 2375, 2382, 2389, 2396, 2403, 2410, 2416, 2423, 2430, 2437, 2444, 2451, 2458, 2465, 2472, 2479, 2486, 2492, 2499, 2506, 2513, 2520, 2527, 2534, 2541, 2548, 2555, 2562, 2568, 2575, 2582, 2589, 2596, 2603, 2610, 2617, 2624, 2631, 2638, 2644, 2651, 2658, 2665, 2672, 2679, 2686, 2693, 2700, 2707, 2714, 2720, 2727, 2734, 2741, 2748, 2755, 2762, 2769, 2776, 2783, 2790, 2795, 2801, 2808, 2815, 2822, 2829, 2836, 2843, 2850, 2857, 2864, 2871, 2877, 2884, 2891, 2898, 2905, 2912, 2919, 2926, 2933, 2940, 2947, 2953, 2960, 2967, 2974, 2981, 2988, 2995, 3002, 3009, 3016, 3023, 3029, 3036, 3043, 3050, 3057, 3064, 3071, 3078, 3085, 3092, 3099, 3105, 3112, 3119, 3126, 3133, 3140, 3147, 3154, 3161, 3168, 3175, 3181, 3188, 3195, 3202, 3209, 3216, 3222, 3228, 3234, 3240, 3245, 3251, 3257, 3263, 3269, 3275, 3281, 3287, 3293, 3299, 3305, 3310, 3316, 3322, 3328, 3334, 3340, 3346, 3352, 3358, 3364, 3370, 3375, 3381, 3387, 3393, 3399, 3405, 3411, 3417, 3423, 3429, 3435, 3440, 3446, 3452, 3458, 3464, 3470, 3476, 3482, 3488, 3494, 3500, 3505, 3511, 3517, 3523, 3529, 3535, 3541, 3547, 3553, 3559, 3565, 3570, 3576, 3582, 3588, 3594, 3600, 3606, 3612, 3618, 3624, 3630, 3635, 3641, 3647, 3653, 3659, 3665, 3671, 3677, 3683, 3689, 3695, 3700, 3705, 3715, 3723, 3739, 3745, 3755, 3769, 3776, 3783, 3793};
+
+#ifdef FORTE_STRING_DICT_FIXED_MEMORY
+  char CStringDictionary::scm_acConstStringBuf[cg_unStringDictInitialStringBufSize]
+#else
+  const char CStringDictionary::scm_acConstStringBuf[] 
+#endif
+  = {"ANY\0ANY_ADAPTER\0ANY_BIT\0ANY_ELEMENTARY\0ANY_INT\0ANY_MAGNITUDE\0ANY_NUM\0ANY_REAL\0ANY_STRING\0ARRAY\0ARTimeOut\0ATimeOut\0ArrayOfStructTest\0BOOL\0BOOL2BOOL\0BYTE\0BYTE2BYTE\0CD\0CDO\0CFB_TEST\0CHANGED\0CLK\0CNF\0CO\0COLD\0CTR\0CU\0CUO\0CV\0D\0DATE\0DATE_AND_TIME\0DEV_MGR\0DINT\0DINT2DINT\0DLY\0DST\0DT\0DWORD\0DWORD2DWORD\0EI\0EI0\0EI1\0EI2\0EMB_RES\0EO\0EO0\0EO1\0EO2\0EO3\0E_CTD\0E_CTU\0E_CTUD\0E_CYCLE\0E_DELAY\0E_DEMUX\0E_DEMUX_2\0E_D_FF\0E_F_TRIG\0E_MERGE\0E_MUX_2\0E_PERMIT\0E_RDELAY\0E_REND\0E_RESTART\0E_RS\0E_RTimeOut\0E_R_TRIG\0E_SELECT\0E_SPLIT\0E_SR\0E_STOPWATCH\0E_SWITCH\0E_TRAIN\0E_T_FF\0E_TimeOut\0FB_RANDOM\0FILE_NAME\0G\0GATE\0GEN_APPEND_STRING\0GEN_ARRAY2ARRAY\0GEN_ARRAY2VALUES\0GEN_CLIENT\0GEN_CSV_WRITER\0GEN_E_DEMUX\0GEN_E_MUX\0GEN_F_MUX\0GEN_PUBL\0GEN_PUBLISH\0GEN_SERVER\0GEN_STRUCT_DEMUX\0GEN_STRUCT_MUX\0GEN_SUBL\0GEN_SUBSCRIBE\0GEN_VALUES2ARRAY\0GET_AT_INDEX\0GET_STRUCT_VALUE\0GET_STRUCT_VALUE_Struct_test1\0GET_STRUCT_VALUE_Struct_test2\0ID\0IN\0IND\0INDEX\0INIT\0INITO\0INT\0INT2INT\0IN_ARRAY\0InstanceName\0K\0LABEL\0LD\0LDO\0LINT\0LOWERCASETEST\0LREAL\0LREAL2LREAL\0LWORD\0MGR\0MGR_FF\0MGR_ID\0N\0OUT\0OUT_ANY_CONSOLE\0OUT_ARRAY\0PERMIT\0PERMIT_OP\0PV\0Q\0QD\0QI\0QO\0QU\0R\0REAL\0REAL2REAL\0REQ\0RESET\0RESET_CHANGED\0RESP\0RMT_RES\0RO\0RQST\0RSP\0S\0SEED\0SET\0SET_AT_INDEX\0SET_CHANGED\0SINT\0SINT2SINT\0SR\0START\0STATUS\0STEST_END\0STOP\0STRING\0STRING2STRING\0STRUCT_DEMUX_1REAL\0STRUCT_DEMUX_1STRING\0STRUCT_DEMUX_1Struct_Muxer_Test_Struct_1\0STRUCT_DEMUX_1Struct_Muxer_Test_Struct_2\0STRUCT_DEMUX_1Struct_Muxer_Test_Struct_3\0STRUCT_DEMUX_1Struct_Muxer_Test_Struct_4\0STRUCT_DEMUX_1UnknownType\0STRUCT_MUX_1REAL\0STRUCT_MUX_1STRING\0STRUCT_MUX_1Struct_Muxer_Test_Struct_1\0STRUCT_MUX_1Struct_Muxer_Test_Struct_2\0STRUCT_MUX_1Struct_Muxer_Test_Struct_3\0STRUCT_MUX_1Struct_Muxer_Test_Struct_4\0STRUCT_MUX_1UnknownType\0Struct_Muxer_Test_Struct_1\0Struct_Muxer_Test_Struct_2\0Struct_Muxer_Test_Struct_3\0Struct_Muxer_Test_Struct_4\0TD\0TEST_CONDITION\0TIME\0TIME2TIME\0TIME_OF_DAY\0TestStruct1\0TestStruct2\0TestStruct3\0TestStruct4\0TimeOut\0TimeOutSocket\0UDINT\0UDINT2UDINT\0UINT\0UINT2UINT\0ULINT\0UNDEFINEDDATATYPE\0USINT\0USINT2USINT\0VAL\0VALUE\0Val1\0Val2\0Val3\0Val4\0Var0\0Var1\0Var10\0Var100\0Var101\0Var102\0Var103\0Var104\0Var105\0Var106\0Var107\0Var108\0Var109\0Var11\0Var110\0Var111\0Var112\0Var113\0Var114\0Var115\0Var116\0Var117\0Var118\0Var119\0Var12\0Var120\0Var121\0Var122\0Var123\0Var124\0Var125\0Var126\0Var127\0Var128\0Var129\0Var13\0Var130\0Var131\0Var132\0Var133\0Var134\0Var135\0Var136\0Var137\0Var138\0Var139\0Var14\0Var140\0Var141\0Var142\0Var143\0Var144\0Var145\0Var146\0Var147\0Var148\0Var149\0Var15\0Var150\0Var151\0Var152\0Var153\0Var154\0Var155\0Var156\0Var157\0Var158\0Var159\0Var16\0Var160\0Var161\0Var162\0Var163\0Var164\0Var165\0Var166\0Var167\0Var168\0Var169\0Var17\0Var170\0Var171\0Var172\0Var173\0Var174\0Var175\0Var176\0Var177\0Var178\0Var179\0Var18\0Var180\0Var181\0Var182\0Var183\0Var184\0Var185\0Var186\0Var187\0Var188\0Var189\0Var19\0Var190\0Var191\0Var192\0Var193\0Var194\0Var195\0Var196\0Var197\0Var198\0Var199\0Var2\0Var20\0Var200\0Var201\0Var202\0Var203\0Var204\0Var205\0Var206\0Var207\0Var208\0Var209\0Var21\0Var210\0Var211\0Var212\0Var213\0Var214\0Var215\0Var216\0Var217\0Var218\0Var219\0Var22\0Var220\0Var221\0Var222\0Var223\0Var224\0Var225\0Var226\0Var227\0Var228\0Var229\0Var23\0Var230\0Var231\0Var232\0Var233\0Var234\0Var235\0Var236\0Var237\0Var238\0Var239\0Var24\0Var240\0Var241\0Var242\0Var243\0Var244\0Var245\0Var246\0Var247\0Var248\0Var249\0Var25\0Var250\0Var251\0Var252\0Var253\0Var254\0Var26\0Var27\0Var28\0Var29\0Var3\0Var30\0Var31\0Var32\0Var33\0Var34\0Var35\0Var36\0Var37\0Var38\0Var39\0Var4\0Var40\0Var41\0Var42\0Var43\0Var44\0Var45\0Var46\0Var47\0Var48\0Var49\0Var5\0Var50\0Var51\0Var52\0Var53\0Var54\0Var55\0Var56\0Var57\0Var58\0Var59\0Var6\0Var60\0Var61\0Var62\0Var63\0Var64\0Var65\0Var66\0Var67\0Var68\0Var69\0Var7\0Var70\0Var71\0Var72\0Var73\0Var74\0Var75\0Var76\0Var77\0Var78\0Var79\0Var8\0Var80\0Var81\0Var82\0Var83\0Var84\0Var85\0Var86\0Var87\0Var88\0Var89\0Var9\0Var90\0Var91\0Var92\0Var93\0Var94\0Var95\0Var96\0Var97\0Var98\0Var99\0WARM\0WORD\0WORD2WORD\0WSTRING\0WSTRING2WSTRING\0check\0in_struct\0lowercasetest\0member\0output\0startTime\0wARM\0"};
+
+ 
@@ -0,0 +1,114 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/arch/poolalloctest.cpp" "tests/CMakeFiles/forte_test.dir/arch/poolalloctest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/arch/poolalloctest.cpp.o.d"
+  "/root/repo/tests/arch/timingwheeltest.cpp" "tests/CMakeFiles/forte_test.dir/arch/timingwheeltest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/arch/timingwheeltest.cpp.o.d"
+  "/root/repo/tests/arch/utils/timespec_utils_tests.cpp" "tests/CMakeFiles/forte_test.dir/arch/utils/timespec_utils_tests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/arch/utils/timespec_utils_tests.cpp.o.d"
+  "/root/repo/tests/core/cominfra/extractLayerAndParamsTest.cpp" "tests/CMakeFiles/forte_test.dir/core/cominfra/extractLayerAndParamsTest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/cominfra/extractLayerAndParamsTest.cpp.o.d"
+  "/root/repo/tests/core/cominfra/fbdkasn1layerdeser_test.cpp" "tests/CMakeFiles/forte_test.dir/core/cominfra/fbdkasn1layerdeser_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/cominfra/fbdkasn1layerdeser_test.cpp.o.d"
+  "/root/repo/tests/core/cominfra/fbdkasn1layerser_test.cpp" "tests/CMakeFiles/forte_test.dir/core/cominfra/fbdkasn1layerser_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/cominfra/fbdkasn1layerser_test.cpp.o.d"
+  "/root/repo/tests/core/cominfra/ipcomlayertest.cpp" "tests/CMakeFiles/forte_test.dir/core/cominfra/ipcomlayertest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/cominfra/ipcomlayertest.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_ANY_tests.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_ANY_tests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_ANY_tests.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_ARRAY_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_ARRAY_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_ARRAY_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_BOOL_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_BOOL_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_BOOL_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_BOOL_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_BOOL_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_BOOL_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_BYTE_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_BYTE_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_BYTE_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_BYTE_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_BYTE_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_BYTE_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_DATE_AND_TIME_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DATE_AND_TIME_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DATE_AND_TIME_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_DATE_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DATE_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DATE_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_DINT_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DINT_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DINT_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_DINT_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DINT_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DINT_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_DWORD_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DWORD_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DWORD_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_DWORD_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DWORD_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_DWORD_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_INT_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_INT_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_INT_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_INT_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_INT_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_INT_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_LINT_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LINT_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LINT_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_LINT_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LINT_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LINT_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_LREAL_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LREAL_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LREAL_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_LREAL_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LREAL_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LREAL_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_LWORD_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LWORD_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LWORD_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_LWORD_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LWORD_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_LWORD_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_PARTIAL/CIEC_BYTE_PARTIAL_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_BYTE_PARTIAL_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_BYTE_PARTIAL_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_PARTIAL/CIEC_DWORD_PARTIAL_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_DWORD_PARTIAL_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_DWORD_PARTIAL_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_PARTIAL/CIEC_LWORD_PARTIAL_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_LWORD_PARTIAL_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_LWORD_PARTIAL_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_PARTIAL/CIEC_WORD_PARTIAL_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_WORD_PARTIAL_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_WORD_PARTIAL_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_REAL_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_REAL_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_REAL_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_REAL_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_REAL_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_REAL_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_SINT_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_SINT_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_SINT_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_SINT_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_SINT_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_SINT_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_STRING_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_STRING_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_STRING_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_STRUCT_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_STRUCT_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_STRUCT_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_TIME_OF_DAY_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_TIME_OF_DAY_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_TIME_OF_DAY_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_TIME_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_TIME_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_TIME_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_UDINT_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_UDINT_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_UDINT_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_UDINT_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_UDINT_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_UDINT_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_UINT_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_UINT_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_UINT_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_UINT_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_UINT_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_UINT_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_ULINT_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_ULINT_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_ULINT_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_ULINT_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_ULINT_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_ULINT_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_USINT_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_USINT_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_USINT_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_USINT_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_USINT_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_USINT_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_WORD_CASTS_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_WORD_CASTS_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_WORD_CASTS_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_WORD_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_WORD_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_WORD_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CIEC_WSTRING_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_WSTRING_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CIEC_WSTRING_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/CUnicodeUtilities_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/CUnicodeUtilities_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/CUnicodeUtilities_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/anytostringtests.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/anytostringtests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/anytostringtests.cpp.o.d"
+  "/root/repo/tests/core/datatypes/convert/convert_functionstests.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/convert/convert_functionstests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/convert/convert_functionstests.cpp.o.d"
+  "/root/repo/tests/core/datatypes/convert/convert_to_STRING_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/convert/convert_to_STRING_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/convert/convert_to_STRING_test.cpp.o.d"
+  "/root/repo/tests/core/datatypes/convert/convert_to_WSTRING_test.cpp" "tests/CMakeFiles/forte_test.dir/core/datatypes/convert/convert_to_WSTRING_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/datatypes/convert/convert_to_WSTRING_test.cpp.o.d"
+  "/root/repo/tests/core/fbcontainertests.cpp" "tests/CMakeFiles/forte_test.dir/core/fbcontainertests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/fbcontainertests.cpp.o.d"
+  "/root/repo/tests/core/fbportindextests.cpp" "tests/CMakeFiles/forte_test.dir/core/fbportindextests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/fbportindextests.cpp.o.d"
+  "/root/repo/tests/core/fbtests/fbtesterglobalfixture.cpp" "tests/CMakeFiles/forte_test.dir/core/fbtests/fbtesterglobalfixture.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/fbtests/fbtesterglobalfixture.cpp.o.d"
+  "/root/repo/tests/core/fbtests/fbtestfixture.cpp" "tests/CMakeFiles/forte_test.dir/core/fbtests/fbtestfixture.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/fbtests/fbtestfixture.cpp.o.d"
+  "/root/repo/tests/core/iec61131_functionstests.cpp" "tests/CMakeFiles/forte_test.dir/core/iec61131_functionstests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/iec61131_functionstests.cpp.o.d"
+  "/root/repo/tests/core/internalvartests.cpp" "tests/CMakeFiles/forte_test.dir/core/internalvartests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/internalvartests.cpp.o.d"
+  "/root/repo/tests/core/mgmstatemachinetest.cpp" "tests/CMakeFiles/forte_test.dir/core/mgmstatemachinetest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/mgmstatemachinetest.cpp.o.d"
+  "/root/repo/tests/core/monitoringtests.cpp" "tests/CMakeFiles/forte_test.dir/core/monitoringtests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/monitoringtests.cpp.o.d"
+  "/root/repo/tests/core/nameidentifiertest.cpp" "tests/CMakeFiles/forte_test.dir/core/nameidentifiertest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/nameidentifiertest.cpp.o.d"
+  "/root/repo/tests/core/stringdicttests.cpp" "tests/CMakeFiles/forte_test.dir/core/stringdicttests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/stringdicttests.cpp.o.d"
+  "/root/repo/tests/core/typelibdatatypetests.cpp" "tests/CMakeFiles/forte_test.dir/core/typelibdatatypetests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/typelibdatatypetests.cpp.o.d"
+  "/root/repo/tests/core/typelibtests.cpp" "tests/CMakeFiles/forte_test.dir/core/typelibtests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/typelibtests.cpp.o.d"
+  "/root/repo/tests/core/utils/alloccheckTest.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/alloccheckTest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/alloccheckTest.cpp.o.d"
+  "/root/repo/tests/core/utils/forte_byteswaptest.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/forte_byteswaptest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/forte_byteswaptest.cpp.o.d"
+  "/root/repo/tests/core/utils/mpmcqueuetest.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/mpmcqueuetest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/mpmcqueuetest.cpp.o.d"
+  "/root/repo/tests/core/utils/mpscqueuetest.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/mpscqueuetest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/mpscqueuetest.cpp.o.d"
+  "/root/repo/tests/core/utils/parameterParserTest.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/parameterParserTest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/parameterParserTest.cpp.o.d"
+  "/root/repo/tests/core/utils/seqlocktest.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/seqlocktest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/seqlocktest.cpp.o.d"
+  "/root/repo/tests/core/utils/singeltontest.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/singeltontest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/singeltontest.cpp.o.d"
+  "/root/repo/tests/core/utils/singletontest2ndunit.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/singletontest2ndunit.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/singletontest2ndunit.cpp.o.d"
+  "/root/repo/tests/core/utils/spscbyteringtest.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/spscbyteringtest.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/spscbyteringtest.cpp.o.d"
+  "/root/repo/tests/core/utils/string_utils_test.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/string_utils_test.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/string_utils_test.cpp.o.d"
+  "/root/repo/tests/core/utils/testsingleton.cpp" "tests/CMakeFiles/forte_test.dir/core/utils/testsingleton.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/core/utils/testsingleton.cpp.o.d"
+  "/root/repo/tests/forte_boost_tester.cpp" "tests/CMakeFiles/forte_test.dir/forte_boost_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/forte_boost_tester.cpp.o.d"
+  "/root/repo/tests/modules/convert/GEN_STRUCT_DEMUX_tester.cpp" "tests/CMakeFiles/forte_test.dir/modules/convert/GEN_STRUCT_DEMUX_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/modules/convert/GEN_STRUCT_DEMUX_tester.cpp.o.d"
+  "/root/repo/tests/modules/convert/GEN_STRUCT_MUX_tester.cpp" "tests/CMakeFiles/forte_test.dir/modules/convert/GEN_STRUCT_MUX_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/modules/convert/GEN_STRUCT_MUX_tester.cpp.o.d"
+  "/root/repo/tests/modules/convert/struct_mux_demux_data.cpp" "tests/CMakeFiles/forte_test.dir/modules/convert/struct_mux_demux_data.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/modules/convert/struct_mux_demux_data.cpp.o.d"
+  "/root/repo/tests/modules/utils/GET_STRUCT_VALUE_tester.cpp" "tests/CMakeFiles/forte_test.dir/modules/utils/GET_STRUCT_VALUE_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/modules/utils/GET_STRUCT_VALUE_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/CFB_TEST.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/CFB_TEST.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/CFB_TEST.cpp.o.d"
+  "/root/repo/tests/stdfblib/CFB_TEST_tester.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/CFB_TEST_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/CFB_TEST_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/events/E_CTD_tester.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_CTD_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_CTD_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/events/E_CTUD_tester.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_CTUD_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_CTUD_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/events/E_CTU_tester.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_CTU_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_CTU_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/events/E_F_TRIG_tester.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_F_TRIG_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_F_TRIG_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/events/E_PERMIT_tester.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_PERMIT_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_PERMIT_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/events/E_R_TRIG_tester.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_R_TRIG_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_R_TRIG_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/events/E_SELECT_tester.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_SELECT_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_SELECT_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/events/E_SR_tester.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_SR_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_SR_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/events/E_SWITCH_tester.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_SWITCH_tester.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/events/E_SWITCH_tester.cpp.o.d"
+  "/root/repo/tests/stdfblib/ita/binarybootfiletests.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/ita/binarybootfiletests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/ita/binarybootfiletests.cpp.o.d"
+  "/root/repo/tests/stdfblib/ita/devmgrsubscriptiontests.cpp" "tests/CMakeFiles/forte_test.dir/stdfblib/ita/devmgrsubscriptiontests.cpp.o" "gcc" "tests/CMakeFiles/forte_test.dir/stdfblib/ita/devmgrsubscriptiontests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,201 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/forte_test.dir/arch/poolalloctest.cpp.o"
+  "CMakeFiles/forte_test.dir/arch/poolalloctest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/arch/timingwheeltest.cpp.o"
+  "CMakeFiles/forte_test.dir/arch/timingwheeltest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/arch/utils/timespec_utils_tests.cpp.o"
+  "CMakeFiles/forte_test.dir/arch/utils/timespec_utils_tests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/cominfra/extractLayerAndParamsTest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/cominfra/extractLayerAndParamsTest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/cominfra/fbdkasn1layerdeser_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/cominfra/fbdkasn1layerdeser_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/cominfra/fbdkasn1layerser_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/cominfra/fbdkasn1layerser_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/cominfra/ipcomlayertest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/cominfra/ipcomlayertest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_ANY_tests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_ANY_tests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_ARRAY_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_ARRAY_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_BOOL_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_BOOL_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_BOOL_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_BOOL_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_BYTE_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_BYTE_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_BYTE_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_BYTE_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DATE_AND_TIME_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DATE_AND_TIME_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DATE_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DATE_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DINT_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DINT_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DINT_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DINT_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DWORD_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DWORD_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DWORD_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_DWORD_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_INT_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_INT_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_INT_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_INT_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LINT_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LINT_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LINT_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LINT_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LREAL_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LREAL_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LREAL_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LREAL_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LWORD_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LWORD_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LWORD_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_LWORD_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_BYTE_PARTIAL_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_BYTE_PARTIAL_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_DWORD_PARTIAL_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_DWORD_PARTIAL_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_LWORD_PARTIAL_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_LWORD_PARTIAL_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_WORD_PARTIAL_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_PARTIAL/CIEC_WORD_PARTIAL_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_REAL_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_REAL_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_REAL_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_REAL_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_SINT_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_SINT_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_SINT_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_SINT_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_STRING_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_STRING_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_STRUCT_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_STRUCT_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_TIME_OF_DAY_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_TIME_OF_DAY_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_TIME_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_TIME_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_UDINT_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_UDINT_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_UDINT_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_UDINT_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_UINT_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_UINT_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_UINT_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_UINT_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_ULINT_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_ULINT_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_ULINT_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_ULINT_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_USINT_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_USINT_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_USINT_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_USINT_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_WORD_CASTS_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_WORD_CASTS_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_WORD_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_WORD_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_WSTRING_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CIEC_WSTRING_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/CUnicodeUtilities_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/CUnicodeUtilities_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/anytostringtests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/anytostringtests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/convert/convert_functionstests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/convert/convert_functionstests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/convert/convert_to_STRING_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/convert/convert_to_STRING_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/datatypes/convert/convert_to_WSTRING_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/datatypes/convert/convert_to_WSTRING_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/fbcontainertests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/fbcontainertests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/fbportindextests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/fbportindextests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/fbtests/fbtesterglobalfixture.cpp.o"
+  "CMakeFiles/forte_test.dir/core/fbtests/fbtesterglobalfixture.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/fbtests/fbtestfixture.cpp.o"
+  "CMakeFiles/forte_test.dir/core/fbtests/fbtestfixture.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/iec61131_functionstests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/iec61131_functionstests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/internalvartests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/internalvartests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/mgmstatemachinetest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/mgmstatemachinetest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/monitoringtests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/monitoringtests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/nameidentifiertest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/nameidentifiertest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/stringdicttests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/stringdicttests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/typelibdatatypetests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/typelibdatatypetests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/typelibtests.cpp.o"
+  "CMakeFiles/forte_test.dir/core/typelibtests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/alloccheckTest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/alloccheckTest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/forte_byteswaptest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/forte_byteswaptest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/mpmcqueuetest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/mpmcqueuetest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/mpscqueuetest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/mpscqueuetest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/parameterParserTest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/parameterParserTest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/seqlocktest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/seqlocktest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/singeltontest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/singeltontest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/singletontest2ndunit.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/singletontest2ndunit.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/spscbyteringtest.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/spscbyteringtest.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/string_utils_test.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/string_utils_test.cpp.o.d"
+  "CMakeFiles/forte_test.dir/core/utils/testsingleton.cpp.o"
+  "CMakeFiles/forte_test.dir/core/utils/testsingleton.cpp.o.d"
+  "CMakeFiles/forte_test.dir/forte_boost_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/forte_boost_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/modules/convert/GEN_STRUCT_DEMUX_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/modules/convert/GEN_STRUCT_DEMUX_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/modules/convert/GEN_STRUCT_MUX_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/modules/convert/GEN_STRUCT_MUX_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/modules/convert/struct_mux_demux_data.cpp.o"
+  "CMakeFiles/forte_test.dir/modules/convert/struct_mux_demux_data.cpp.o.d"
+  "CMakeFiles/forte_test.dir/modules/utils/GET_STRUCT_VALUE_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/modules/utils/GET_STRUCT_VALUE_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/CFB_TEST.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/CFB_TEST.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/CFB_TEST_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/CFB_TEST_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_CTD_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_CTD_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_CTUD_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_CTUD_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_CTU_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_CTU_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_F_TRIG_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_F_TRIG_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_PERMIT_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_PERMIT_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_R_TRIG_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_R_TRIG_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_SELECT_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_SELECT_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_SR_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_SR_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_SWITCH_tester.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/events/E_SWITCH_tester.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/ita/binarybootfiletests.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/ita/binarybootfiletests.cpp.o.d"
+  "CMakeFiles/forte_test.dir/stdfblib/ita/devmgrsubscriptiontests.cpp.o"
+  "CMakeFiles/forte_test.dir/stdfblib/ita/devmgrsubscriptiontests.cpp.o.d"
+  "forte_test"
+  "forte_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/forte_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()